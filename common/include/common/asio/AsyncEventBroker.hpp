@@ -36,13 +36,15 @@ namespace common::asio
  * @brief Represents a single connected subscriber client.
  *
  * Owns the TCP socket and dispatches received frames to the broker via callbacks.
- * The session removes itself from the registry on EOF.
+ * The session removes itself from the registry on EOF. Frames are received into pooled
+ * buffers and DATA frames are handed on as they are, so a payload travels from the
+ * publisher to every subscriber without being copied.
  */
 class COMMON_LIB_API ClientSession : public std::enable_shared_from_this<ClientSession>
 {
     using onSubscribe = std::function<void(uint16_t, std::shared_ptr<ClientSession>)>;
     using onUnsubscribe = std::function<void(std::shared_ptr<ClientSession>)>;
-    using onEvent = std::function<void(uint16_t, const Bytes&)>;
+    using onEvent = std::function<void(uint16_t, const memory::Buffer&)>;
 
 private :
     std::shared_ptr<asio::AsyncTcpSocket> _socket;
@@ -73,8 +75,14 @@ public :
      */
     auto send(const Bytes& bytesFrame) -> void;
 
+    /**
+     * @brief Sends a serialized frame to the connected client without copying it.
+     * @param bufferFrame Serialized frame, may be shared with other sessions.
+     */
+    auto send(memory::Buffer bufferFrame) -> void;
+
 private :
-    auto onReceive(const Bytes& raw) -> void;
+    auto onReceive(memory::Buffer raw) -> void;
 };
 
 /**
@@ -110,6 +118,14 @@ public :
      * @param payload Event payload bytes.
      */
     auto route(uint16_t topic, const Bytes& payload) -> void;
+
+    /**
+     * @brief Forwards an already serialized DATA frame to all sessions registered under @p topic.
+     * @param topic Topic to route to.
+     * @param frame The frame as received from the publisher. Its bytes are shared by all
+     *        sessions, nothing is copied.
+     */
+    auto forward(uint16_t topic, const memory::Buffer& frame) -> void;
 };
 
 /**
@@ -91,11 +91,21 @@ public :
      * On ACK receipt, @p onSubscribedHandler is called. On DATA receipt, @p onMessageHandler
      * is called. Both callbacks are invoked in an IOContext worker thread.
      *
-     * @param onMessageHandler Called with raw payload bytes on DATA frame receipt.
+     * @param onMessageHandler Called with raw payload bytes on DATA frame receipt. The bytes are
+     *        copied out of the receive buffer; use subscribe_buffer() to avoid that.
      * @param onSubscribedHandler Called once the broker acknowledges the subscription (ACK).
      * @note Aborts in STRICT_MODE if socket already exists (already subscribed).
      */
     auto subscribe(communication::onMessage onMessageHandler, 
                    communication::onSubscribed onSubscribedHandler) -> void override;
+
+    /**
+     * @brief Same as subscribe(), but the payload is handed over as a slice of the receive buffer.
+     *
+     * Together with the broker forwarding frames as received, the payload reaches the
+     * subscriber without a copy after the publisher serialized it.
+     */
+    auto subscribe_buffer(communication::onBufferMessage onMessageHandler, 
+                          communication::onSubscribed onSubscribedHandler) -> void override;
 };
 } // common::asio
\ No newline at end of file
@@ -27,6 +27,8 @@ SOFTWARE.
 #include "common/CommonHeader.hpp"
 #include "common/ErrorCode.hpp"
 #include "common/communication/Socket.hpp"
+#include "common/container/Span.hpp"
+#include "common/memory/Buffer.hpp"
 
 #include <asio/error_code.hpp>
 
@@ -43,6 +45,10 @@ namespace common::asio
  * (4-byte header + payload), so send/receive must only be used between
  * two AsyncTcpSocket instances sharing the same framing protocol.
  *
+ * Outgoing messages go through a per-socket queue: only one write is in flight at a
+ * time, and the messages that piled up meanwhile are written together in a single
+ * gathered write (writev), so concurrent senders never interleave on the wire.
+ *
  * @note IOContext::run() must be called before using this class.
  * @note NonCopyable - pass and store instances via shared_ptr only.
  */
@@ -54,8 +60,21 @@ class COMMON_LIB_API AsyncTcpSocket : public NonCopyable
 public :
     using onConnect = std::function<void()>;
     using onReceive = std::function<void(const std::vector<uint8_t>&)>;
+    using onReceiveBuffer = std::function<void(memory::Buffer)>;
+    using onReceiveBatch = std::function<void(Span<const Span<const uint8_t>> messages)>;
     using onSend    = std::function<void(size_t bytes)>;
     using onError   = std::function<void(const ErrorCode::type& ec)>;
+    using onWritable = std::function<void(bool writable)>;
+
+    /**
+     * @brief Maximum number of queued messages written by one gathered write.
+     */
+    static constexpr size_t MAX_COALESCED_MESSAGES = 32;
+
+    /**
+     * @brief Size of the chunks the receive loop reads at once.
+     */
+    static constexpr size_t RECEIVE_CHUNK_SIZE = 64 * 1024;
 
     virtual ~AsyncTcpSocket() = default;
 
@@ -83,13 +102,39 @@ public :
      * @param onReceiveHandler Callback invoked for each received message with the complete payload.
      * @param onErrorHandler   Callback invoked on receive error, including eof (optional).
      *
-     * Reads a 4-byte length-prefix header first, then reads exactly that many bytes,
-     * guaranteeing message boundaries. The loop stops on any error.
+     * Reads the stream in chunks of up to RECEIVE_CHUNK_SIZE bytes and splits it at the
+     * 4-byte length-prefix headers, guaranteeing message boundaries. Every complete message
+     * in a chunk is delivered before the next read. The loop stops on any error.
      *
-     * @note Do not call receive more than once on the same socket.
+     * @note Do not call receive(), receive_buffer() or receive_batch() more than once on the same socket.
      */
     virtual auto receive(onReceive onReceiveHandler, onError onErrorHandler = nullptr) -> void = 0;
 
+    /**
+     * @brief Starts an asynchronous receive loop that reads each message into a pooled buffer.
+     * @param onReceiveHandler Callback invoked for each received message with the complete payload.
+     * @param onErrorHandler   Callback invoked on receive error, including eof (optional).
+     *
+     * Same as receive(), but the payload is handed over in a memory::Buffer, which the
+     * callback may keep or pass on without copying the bytes. The Buffer is a slice of the
+     * chunk it was read into, so keeping it keeps the whole chunk.
+     *
+     * @note Do not call receive(), receive_buffer() or receive_batch() more than once on the same socket.
+     */
+    virtual auto receive_buffer(onReceiveBuffer onReceiveHandler, onError onErrorHandler = nullptr) -> void = 0;
+
+    /**
+     * @brief Starts an asynchronous receive loop that delivers all complete messages of a chunk at once.
+     * @param onReceiveHandler Callback invoked once per read with the payloads of every complete message.
+     * @param onErrorHandler   Callback invoked on receive error, including eof (optional).
+     *
+     * The payloads are views into the receive chunk and are only valid during the callback;
+     * nothing is copied or allocated per message.
+     *
+     * @note Do not call receive(), receive_buffer() or receive_batch() more than once on the same socket.
+     */
+    virtual auto receive_batch(onReceiveBatch onReceiveHandler, onError onErrorHandler = nullptr) -> void = 0;
+
     /**
      * @brief Sends data asynchronously.
      * @param data           Byte array to transmit.
@@ -98,11 +143,53 @@ public :
      *
      * Prepends a 4-byte length-prefix header before transmission.
      * data is copied internally, so it is safe to release the buffer immediately after the call.
+     * Messages are written in the order send() was called, callbacks run on the IOContext.
      */
     virtual auto send(const std::vector<uint8_t>& data, 
                       onSend onSendHandler = nullptr, 
                       onError onErrorHandler = nullptr) -> void = 0;
 
+    /**
+     * @brief Sends a buffer asynchronously without copying it.
+     * @param data           Bytes to transmit. The socket keeps a reference until the write completes.
+     * @param onSendHandler  Callback invoked on completion; bytes includes the 4-byte header (optional).
+     * @param onErrorHandler Callback invoked on send error (optional).
+     *
+     * The length-prefix header is written into the headroom of @p data when it has 4 bytes
+     * to spare and is not shared, otherwise it is sent from a separate block in the same write.
+     * The same buffer may therefore be sent to many sockets at once.
+     */
+    virtual auto send(memory::Buffer data, 
+                      onSend onSendHandler = nullptr, 
+                      onError onErrorHandler = nullptr) -> void = 0;
+
+    /**
+     * @brief Sets the outgoing queue watermarks used for backpressure.
+     * @param highWatermark     Queued bytes above which the socket stops being writable, 0 disables (default).
+     * @param lowWatermark      Queued bytes at or below which it becomes writable again.
+     * @param onWritableHandler Callback invoked with false when the high watermark is crossed and
+     *                          with true when the queue has drained to the low watermark (optional).
+     *
+     * send() never drops a message; senders are expected to check writable() or wait for the
+     * callback. @p lowWatermark is clamped to @p highWatermark.
+     *
+     * The callback alternates between false and true, is never run concurrently with itself
+     * and may call send().
+     */
+    virtual auto set_watermarks(size_t highWatermark, 
+                                size_t lowWatermark, 
+                                onWritable onWritableHandler = nullptr) -> void = 0;
+
+    /**
+     * @brief Bytes queued or being written, length-prefix headers included.
+     */
+    virtual auto queued_bytes() const noexcept -> size_t = 0;
+
+    /**
+     * @brief Checks whether the outgoing queue is below the high watermark.
+     */
+    virtual auto writable() const noexcept -> bool = 0;
+
 private :
     static auto __create(const communication::Connection& conn) noexcept -> std::shared_ptr<AsyncTcpSocket>;
 };
@@ -28,6 +28,7 @@ SOFTWARE.
 #include "common/Singleton.hpp"
 #include "common/Logger.hpp"
 #include "common/threading/TaskExecutor.hpp"
+#include "common/threading/TimerService.hpp"
 
 #include <asio/io_context.hpp>
 #include <asio/executor_work_guard.hpp>
@@ -147,5 +148,16 @@ public :
     {
         ::asio::dispatch(_context, std::forward<Handler>(handler));
     }
+
+    /**
+     * @brief Returns a dispatcher that runs the callbacks of a threading::TimerService on this io_context.
+     * @code
+     *   auto timers = threading::TimerService::create(IOContext::get_instance()->timer_dispatcher());
+     * @endcode
+     */
+    auto timer_dispatcher() -> threading::TimerService::Dispatcher
+    {
+        return [this](threading::Task&& task) { post(std::move(task)); };
+    }
 };
 } // namespace common::asio
\ No newline at end of file
@@ -24,6 +24,10 @@ SOFTWARE.
 #pragma once
 
 #include "common/CommonHeader.hpp"
+#include "common/container/Span.hpp"
+#include "common/memory/Buffer.hpp"
+
+#include <cstring>
 
 namespace common::communication
 {
@@ -45,6 +49,8 @@ struct Frame
         ACK,
     };
 
+    static constexpr size_t HEADER_SIZE = 3;
+
     uint16_t _topic;
     type _type;
     Bytes payload;
@@ -84,5 +90,69 @@ struct Frame
 
         return message;
     }
+
+    /**
+     * @brief Serializes frame fields in front of a payload buffer.
+     * @param topic Topic identifier (big-endian, 2 bytes).
+     * @param type Frame type discriminator.
+     * @param payload Payload bytes, ideally allocated with at least @c HEADER_SIZE bytes of headroom.
+     * @return Serialized frame ready for transmission. The header is written into the headroom
+     *         of @p payload when possible, otherwise the payload is copied into a new buffer.
+     */
+    static auto make(uint16_t topic, Frame::type type, memory::Buffer payload) -> memory::Buffer
+    {
+        if(payload.headroom() < HEADER_SIZE || payload.use_count() > 1)
+        {
+            auto copy = memory::Buffer::allocate(payload.size());
+            if(!payload.empty()) { std::memcpy(copy.data(), payload.data(), payload.size()); }
+            payload = std::move(copy);
+        }
+
+        uint8_t* header = payload.prepend(HEADER_SIZE);
+        header[0] = static_cast<uint8_t>(topic >> 8);
+        header[1] = static_cast<uint8_t>(topic & 0xFF);
+        header[2] = static_cast<uint8_t>(type);
+        return payload;
+    }
+};
+
+/**
+ * @brief Frame parsed in place over borrowed bytes.
+ *
+ * Unlike Frame::parse() nothing is copied; @c _payload points into the parsed memory,
+ * which must outlive the view.
+ */
+struct FrameView
+{
+    uint16_t _topic = 0;
+    Frame::type _type = Frame::DATA;
+    Span<const uint8_t> _payload;
+
+    /**
+     * @brief Parses raw bytes into a FrameView.
+     * @param raw Raw bytes of one frame; must be at least @c Frame::HEADER_SIZE bytes long.
+     * @param size Number of bytes at @p raw.
+     * @return View of the topic, type, and payload.
+     * @warning Asserts @c size >= 3. Passing a shorter buffer is undefined behavior.
+     */
+    static auto parse(const uint8_t* raw, size_t size) -> FrameView
+    {
+        assert(size >= Frame::HEADER_SIZE);
+
+        const uint16_t topic = (static_cast<uint16_t>(raw[0] << 8) | raw[1]);
+        const auto type = static_cast<Frame::type>(raw[2]);
+        return {topic, type, {raw + Frame::HEADER_SIZE, size - Frame::HEADER_SIZE}};
+    }
+
+    static auto parse(const Bytes& raw) -> FrameView { return parse(raw.data(), raw.size()); }
+    static auto parse(const memory::Buffer& raw) -> FrameView { return parse(raw.data(), raw.size()); }
+
+    /**
+     * @brief Copies the viewed frame into an owning Frame.
+     */
+    auto to_frame() const -> Frame
+    {
+        return {_topic, _type, Bytes(_payload.begin(), _payload.end())};
+    }
 };
 } // namespace common::communication
\ No newline at end of file
@@ -25,6 +25,7 @@ SOFTWARE.
 
 #include "common/CommonHeader.hpp"
 #include "common/Logger.hpp"
+#include "common/memory/Buffer.hpp"
 
 #include <functional>
 
@@ -33,6 +34,9 @@ namespace common::communication
 /// @brief Callback invoked when a DATA frame payload is received.
 using onMessage = std::function<void(Bytes)>;
 
+/// @brief Callback invoked with a DATA frame payload that still lives in the receive buffer.
+using onBufferMessage = std::function<void(memory::Buffer)>;
+
 /// @brief Callback invoked once the broker acknowledges the subscription.
 using onSubscribed = std::function<void()>;
 
@@ -76,5 +80,18 @@ public :
         LogError << "Default operation: subscribe";
         if constexpr (STRICT_MODE_ENABLED) { std::abort(); }
     }
+
+    /**
+     * @brief Same as subscribe(), but hands over the payload without copying it.
+     * @param onMessageHandler Called with the payload on DATA frame receipt; it may keep the Buffer.
+     * @param onSubscribedHandler Optional. Called when the broker sends an ACK. Defaults to nullptr.
+     * @note Default implementation logs an error and aborts in STRICT_MODE.
+     */
+    virtual auto subscribe_buffer([[maybe_unused]] onBufferMessage onMessageHandler,
+                                  [[maybe_unused]] onSubscribed onSubscribedHandler = nullptr) -> void
+    {
+        LogError << "Default operation: subscribe_buffer";
+        if constexpr (STRICT_MODE_ENABLED) { std::abort(); }
+    }
 };
 } // namespace common::communication
\ No newline at end of file
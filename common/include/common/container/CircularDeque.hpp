@@ -0,0 +1,130 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace common
+{
+/**
+ * @class CircularDeque
+ * @brief Growable double-ended queue on a single power-of-two ring buffer
+ *
+ * Unlike std::deque, which allocates and frees fixed-size chunks as elements come
+ * and go, CircularDeque only allocates when it has to grow. Once it has reached its
+ * working size, push/pop at either end never touch the heap.
+ *
+ * @tparam T Element type. Must be default constructible and move assignable.
+ * @note Not thread-safe.
+ */
+template <typename T>
+class CircularDeque
+{
+private :
+    std::vector<T> _buffer;
+    size_t _head = 0;
+    size_t _size = 0;
+
+public :
+    explicit CircularDeque(size_t capacity = 16) { _buffer.resize(round_up(capacity)); }
+
+public :
+    auto empty() const noexcept -> bool { return _size == 0; }
+    auto size() const noexcept -> size_t { return _size; }
+    auto capacity() const noexcept -> size_t { return _buffer.size(); }
+
+    auto front() -> T& { return _buffer[_head]; }
+    auto back() -> T& { return _buffer[(_head + _size - 1) & mask()]; }
+    auto operator[](size_t index) -> T& { return _buffer[(_head + index) & mask()]; }
+
+    auto push_back(T&& value) -> void
+    {
+        if(_size == _buffer.size()) { grow(); }
+        _buffer[(_head + _size) & mask()] = std::move(value);
+        ++_size;
+    }
+
+    auto push_front(T&& value) -> void
+    {
+        if(_size == _buffer.size()) { grow(); }
+        _head = (_head - 1) & mask();
+        _buffer[_head] = std::move(value);
+        ++_size;
+    }
+
+    /**
+     * @brief Removes and returns the first element.
+     * @warning The deque must not be empty.
+     */
+    auto pop_front() -> T
+    {
+        T value = std::move(_buffer[_head]);
+        _buffer[_head] = T();
+        _head = (_head + 1) & mask();
+        --_size;
+        return value;
+    }
+
+    /**
+     * @brief Removes and returns the last element.
+     * @warning The deque must not be empty.
+     */
+    auto pop_back() -> T
+    {
+        auto& slot = _buffer[(_head + _size - 1) & mask()];
+        T value = std::move(slot);
+        slot = T();
+        --_size;
+        return value;
+    }
+
+    auto clear() -> void
+    {
+        while(!empty()) { pop_front(); }
+        _head = 0;
+    }
+
+private :
+    auto mask() const noexcept -> size_t { return _buffer.size() - 1; }
+
+    static auto round_up(size_t n) noexcept -> size_t
+    {
+        size_t capacity = 1;
+        while(capacity < n) { capacity <<= 1; }
+        return capacity;
+    }
+
+    auto grow() -> void
+    {
+        std::vector<T> buffer(_buffer.size() * 2);
+        for(size_t i = 0; i < _size; ++i) { buffer[i] = std::move((*this)[i]); }
+        _buffer.swap(buffer);
+        _head = 0;
+    }
+};
+} // namespace common
@@ -24,9 +24,16 @@ SOFTWARE.
 
 #pragma once
 
+#include "common/memory/BlockPool.hpp"
+
 #include <atomic>
 #include <memory>
-#include <functional>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace common
 {
@@ -35,67 +42,121 @@ inline namespace v2
 
 // Chase-Lev Work-Stealing Deque
 // 소유자 스레드는 bottom에서 push/pop, 다른 스레드들은 top에서 steal
+//
+// - 포인터나 정수처럼 lock-free atomic 으로 다룰 수 있는 T 는 슬롯에 직접 저장하고,
+//   그 외의 T (move-only 포함) 는 BlockPool 에 박싱하여 포인터만 슬롯에 저장
+// - 확장/축소로 교체된 배열은 진행 중인 steal 이 없을 때 소유자 스레드가 해제
+// - 사용률이 1/8 미만으로 떨어지면 초기 크기까지 절반씩 축소
 template<typename T>
 class LockFreeWorkQueue
 {
 private:
+    template<typename U, bool = std::is_trivially_copyable_v<U>>
+    struct IsAtomicValue : std::false_type {};
+
+    template<typename U>
+    struct IsAtomicValue<U, true> : std::bool_constant<std::atomic<U>::is_always_lock_free> {};
+
+    static constexpr bool INLINE_STORAGE = IsAtomicValue<T>::value;
+    static constexpr size_t CACHE_LINE = 64;
+
+    // 슬롯에 저장되는 값 (T 또는 박싱된 T 의 포인터)
+    using Value = std::conditional_t<INLINE_STORAGE, T, T*>;
+
+    static_assert(INLINE_STORAGE || alignof(T) <= alignof(std::max_align_t), 
+                  "Over-aligned element types are not supported");
+
     struct CircularArray
     {
-        std::atomic<T*> _buffer;
-        size_t _size;
-        
-        CircularArray(size_t size) : _size(size)
-        {
-            _buffer.store(new T[size]);
-        }
+        std::unique_ptr<std::atomic<Value>[]> _buffer;
+        int64_t _size;
         
-        ~CircularArray()
+        CircularArray(int64_t size) 
+            : _buffer(new std::atomic<Value>[static_cast<size_t>(size)]())
+            , _size(size)
         {
-            delete[] _buffer.load();
         }
         
-        T get(size_t index) const
+        Value get(int64_t index) const
         {
-            return _buffer.load()[index % _size];
+            return _buffer[static_cast<size_t>(index & (_size - 1))].load(std::memory_order_relaxed);
         }
         
-        void put(size_t index, const T& item)
+        void put(int64_t index, Value item)
         {
-            _buffer.load()[index % _size] = item;
+            _buffer[static_cast<size_t>(index & (_size - 1))].store(item, std::memory_order_relaxed);
         }
         
-        std::unique_ptr<CircularArray> resize(size_t bottom, size_t top)
+        // [top, bottom) 구간을 새 배열로 복사 (값만 복사하므로 동시에 steal 해도 안전)
+        std::unique_ptr<CircularArray> resize(int64_t bottom, int64_t top, int64_t size) const
         {
-            auto newArray = std::make_unique<CircularArray>(_size * 2);
-            T* oldBuffer = _buffer.load();
+            auto newArray = std::make_unique<CircularArray>(size);
             
-            for (size_t i = top; i < bottom; ++i)
+            for (int64_t i = top; i < bottom; ++i)
             {
-                newArray->put(i, oldBuffer[i % _size]);
+                newArray->put(i, get(i));
             }
             
             return newArray;
         }
-    };    std::atomic<size_t> _top{0};
-    std::atomic<size_t> _bottom{0};
-    std::atomic<std::shared_ptr<CircularArray>> _array;
+    };
+
+    // top 은 steal 하는 스레드들이, bottom 은 소유자 스레드가 갱신하므로 서로 다른 캐시 라인에 배치
+    // 인덱스는 부호 있는 정수로 관리 (빈 큐에서 bottom - 1 이 언더플로우 되지 않도록)
+    struct alignas(CACHE_LINE) Top
+    {
+        std::atomic<int64_t> _value{0};
+        std::atomic<uint32_t> _stealers{0};  // 배열을 읽고 있는 steal 수
+    };
+
+    struct alignas(CACHE_LINE) Bottom
+    {
+        std::atomic<int64_t> _value{0};
+        std::atomic<CircularArray*> _array{nullptr};
+    };
+
+    Top _top;
+    Bottom _bottom;
+
+    // 아래는 소유자 스레드만 접근
+    std::unique_ptr<CircularArray> _owned;
+    std::vector<std::unique_ptr<CircularArray>> _retired;   // steal 이 끝나면 해제할 이전 배열들
+    int64_t _minSize;
     
     // 성능 모니터링용 카운터들
     mutable std::atomic<size_t> _resizeCount{0};
+    mutable std::atomic<size_t> _shrinkCount{0};
     mutable std::atomic<size_t> _maxSize{0};
 
 public:
-    // 사용 패턴에 따른 초기 크기 설정
+    // 사용 패턴에 따른 초기 크기 설정 (축소 시 하한)
     explicit LockFreeWorkQueue(size_t initialSize = 256) 
-        : _array(std::make_shared<CircularArray>(nextPowerOf2(initialSize)))
+        : _owned(std::make_unique<CircularArray>(static_cast<int64_t>(nextPowerOf2(initialSize))))
+        , _minSize(_owned->_size)
     {
+        _bottom._array.store(_owned.get());
     }
 
+    ~LockFreeWorkQueue()
+    {
+        if constexpr (!INLINE_STORAGE)
+        {
+            const int64_t bottom = _bottom._value.load(std::memory_order_relaxed);
+            for (int64_t i = _top._value.load(std::memory_order_relaxed); i < bottom; ++i)
+            {
+                release(_owned->get(i));
+            }
+        }
+    }
+
+    LockFreeWorkQueue(const LockFreeWorkQueue&) = delete;
+    LockFreeWorkQueue& operator=(const LockFreeWorkQueue&) = delete;
+
 private:
     // 2의 거듭제곱으로 올림
     static constexpr size_t nextPowerOf2(size_t n) noexcept
     {
-        if (n <= 1) return 1;
+        if (n <= 1) return 2;
         n--;
         n |= n >> 1;
         n |= n >> 2;
@@ -106,68 +167,137 @@ private:
         return n + 1;
     }
 
+    template<typename... Args>
+    static Value box(Args&&... args)
+    {
+        if constexpr (INLINE_STORAGE)
+        {
+            return T(std::forward<Args>(args)...);
+        }
+        else
+        {
+            void* block = memory::BlockPool::allocate(sizeof(T));
+            return new (block) T(std::forward<Args>(args)...);
+        }
+    }
+
+    // steal/pop 으로 소유권을 얻은 값을 꺼냄
+    static void unbox(Value value, T& result)
+    {
+        if constexpr (INLINE_STORAGE)
+        {
+            result = value;
+        }
+        else
+        {
+            result = std::move(*value);
+            release(value);
+        }
+    }
+
+    static void release([[maybe_unused]] Value value) noexcept
+    {
+        if constexpr (!INLINE_STORAGE)
+        {
+            value->~T();
+            memory::BlockPool::deallocate(value, sizeof(T));
+        }
+    }
+
+    // 소유자 스레드가 배열을 교체하고 이전 배열은 해제 대기 목록으로 이동
+    void replace(std::unique_ptr<CircularArray> array)
+    {
+        _retired.push_back(std::move(_owned));
+        _owned = std::move(array);
+        _bottom._array.store(_owned.get(), std::memory_order_seq_cst);
+        reclaim();
+    }
+
+    // 배열을 읽고 있는 steal 이 없으면 이전 배열들을 해제
+    // steal 은 카운터를 올린 뒤 배열을 읽으므로, 0 을 관찰한 시점 이후의 steal 은 새 배열만 봄
+    void reclaim()
+    {
+        if (!_retired.empty() && _top._stealers.load(std::memory_order_seq_cst) == 0)
+        {
+            _retired.clear();
+        }
+    }
+
 public:    // 소유자 스레드가 bottom에 작업 추가
-    void push(const T& item)
+    void push(const T& item) { emplace(item); }
+    void push(T&& item) { emplace(std::move(item)); }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed);
-        size_t top = _top.load(std::memory_order_acquire);
+        int64_t bottom = _bottom._value.load(std::memory_order_relaxed);
+        int64_t top = _top._value.load(std::memory_order_acquire);
         
-        auto array = _array.load(std::memory_order_relaxed);
-          // 큐가 가득 찬 경우 크기 확장 (75% 사용률에서 확장)
+        CircularArray* array = _owned.get();
+        // 큐가 가득 찬 경우 크기 확장 (75% 사용률에서 확장)
         if (bottom - top >= array->_size * 3 / 4)
         {
-            auto newArray = array->resize(bottom, top);
-            _array.store(newArray, std::memory_order_release);
-            array = newArray;
+            replace(array->resize(bottom, top, array->_size * 2));
+            array = _owned.get();
             _resizeCount.fetch_add(1, std::memory_order_relaxed);
         }
+        else
+        {
+            reclaim();
+        }
         
-        array->put(bottom, item);
-        std::atomic_thread_fence(std::memory_order_release);
-        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        array->put(bottom, box(std::forward<Args>(args)...));
+        // release store: steal 이 bottom 을 acquire 로 읽으면 슬롯과 박싱된 값이 보임
+        _bottom._value.store(bottom + 1, std::memory_order_release);
         
-        // 최대 크기 추적
-        size_t currentSize = bottom - top + 1;
-        size_t maxSize = _maxSize.load(std::memory_order_relaxed);
-        while (currentSize > maxSize && 
-               !_maxSize.compare_exchange_weak(maxSize, currentSize, std::memory_order_relaxed)) {
-            // CAS 재시도
+        // 최대 크기 추적 (소유자 스레드만 갱신)
+        size_t currentSize = static_cast<size_t>(bottom - top + 1);
+        if (currentSize > _maxSize.load(std::memory_order_relaxed))
+        {
+            _maxSize.store(currentSize, std::memory_order_relaxed);
         }
     }
 
     // 소유자 스레드가 bottom에서 작업 제거
     bool pop(T& result)
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
-        auto array = _array.load(std::memory_order_relaxed);
-        _bottom.store(bottom, std::memory_order_relaxed);
+        int64_t bottom = _bottom._value.load(std::memory_order_relaxed) - 1;
+        CircularArray* array = _owned.get();
+        _bottom._value.store(bottom, std::memory_order_relaxed);
         
         std::atomic_thread_fence(std::memory_order_seq_cst);
-        size_t top = _top.load(std::memory_order_relaxed);
+        int64_t top = _top._value.load(std::memory_order_relaxed);
         
         if (top <= bottom)
         {
             // 큐에 작업이 있음
-            result = array->get(bottom);
+            Value value = array->get(bottom);
             
             if (top == bottom)
             {
                 // 마지막 작업인 경우 경쟁 상황 체크
-                if (!_top.compare_exchange_strong(top, top + 1, 
+                if (!_top._value.compare_exchange_strong(top, top + 1, 
                     std::memory_order_seq_cst, std::memory_order_relaxed))
                 {
                     // steal에 의해 이미 가져감
-                    _bottom.store(bottom + 1, std::memory_order_relaxed);
+                    _bottom._value.store(bottom + 1, std::memory_order_relaxed);
                     return false;
                 }
-                _bottom.store(bottom + 1, std::memory_order_relaxed);
+                _bottom._value.store(bottom + 1, std::memory_order_relaxed);
             }
+            else if (array->_size > _minSize && bottom - top < array->_size / 8)
+            {
+                // 사용률이 1/8 미만이면 절반으로 축소 (축소 후 사용률 1/4 미만, 확장 기준과 충분히 떨어짐)
+                replace(array->resize(bottom, top, array->_size / 2));
+                _shrinkCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            unbox(value, result);
             return true;
         }
         else
         {
             // 큐가 비어있음
-            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            _bottom._value.store(bottom + 1, std::memory_order_relaxed);
             return false;
         }
     }
@@ -175,20 +305,24 @@ public:    // 소유자 스레드가 bottom에 작업 추가
     // 다른 스레드가 top에서 작업 훔쳐가기
     bool steal(T& result)
     {
-        size_t top = _top.load(std::memory_order_acquire);
+        int64_t top = _top._value.load(std::memory_order_acquire);
         std::atomic_thread_fence(std::memory_order_seq_cst);
-        size_t bottom = _bottom.load(std::memory_order_acquire);
+        int64_t bottom = _bottom._value.load(std::memory_order_acquire);
         
         if (top < bottom)
         {
-            auto array = _array.load(std::memory_order_consume);
-            result = array->get(top);
+            // 배열을 읽는 동안에는 소유자 스레드가 이전 배열을 해제하지 못하도록 표시
+            _top._stealers.fetch_add(1, std::memory_order_seq_cst);
+            CircularArray* array = _bottom._array.load(std::memory_order_seq_cst);
+            Value value = array->get(top);
+            _top._stealers.fetch_sub(1, std::memory_order_release);
             
-            if (!_top.compare_exchange_strong(top, top + 1,
+            if (!_top._value.compare_exchange_strong(top, top + 1,
                 std::memory_order_seq_cst, std::memory_order_relaxed))
             {
                 return false;  // 다른 스레드가 먼저 steal함
             }
+            unbox(value, result);
             return true;
         }
         
@@ -198,21 +332,24 @@ public:    // 소유자 스레드가 bottom에 작업 추가
     // 큐가 비어있는지 확인 (정확하지 않을 수 있음, 힌트용)
     bool empty() const
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed);
-        size_t top = _top.load(std::memory_order_relaxed);
+        int64_t bottom = _bottom._value.load(std::memory_order_relaxed);
+        int64_t top = _top._value.load(std::memory_order_relaxed);
         return top >= bottom;
-    }    // 큐의 대략적인 크기 (정확하지 않을 수 있음, 힌트용)
+    }
+    
+    // 큐의 대략적인 크기 (정확하지 않을 수 있음, 힌트용)
     size_t size() const
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed);
-        size_t top = _top.load(std::memory_order_relaxed);
-        return bottom >= top ? bottom - top : 0;
+        int64_t bottom = _bottom._value.load(std::memory_order_relaxed);
+        int64_t top = _top._value.load(std::memory_order_relaxed);
+        return bottom >= top ? static_cast<size_t>(bottom - top) : 0;
     }
     
     // 성능 통계 조회
     size_t getResizeCount() const { return _resizeCount.load(std::memory_order_relaxed); }
+    size_t getShrinkCount() const { return _shrinkCount.load(std::memory_order_relaxed); }
     size_t getMaxSize() const { return _maxSize.load(std::memory_order_relaxed); }
-    size_t getCapacity() const { return _array.load(std::memory_order_relaxed)->_size; }
+    size_t getCapacity() const { return static_cast<size_t>(_bottom._array.load(std::memory_order_relaxed)->_size); }
 };
 
 } // v2
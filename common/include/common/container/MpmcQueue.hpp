@@ -0,0 +1,384 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/utils/Misc.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace common
+{
+/**
+ * @class MpmcQueue
+ * @brief Bounded lock-free multi-producer/multi-consumer queue
+ *
+ * A power-of-two ring of slots after Dmitry Vyukov's bounded MPMC queue. Every slot
+ * carries a sequence number that tells producers and consumers whose turn it is, so a
+ * push or pop costs one CAS on the shared position plus one release store on the
+ * slot, and producers never touch the consumer position (and vice versa). The two
+ * positions live on separate cache lines.
+ *
+ * try_push() / try_pop() fail immediately on a full / empty queue. push() / pop()
+ * spin briefly, then block until they can proceed or the queue is closed, which gives
+ * backpressure without a mutex on the fast path. push_n() / pop_n() move a batch of
+ * items with a single CAS.
+ *
+ * @tparam T Element type. Must be move constructible and move assignable.
+ */
+template <typename T>
+class MpmcQueue
+{
+private :
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr uint32_t SPIN_COUNT = 64;
+
+    struct Slot
+    {
+        std::atomic<size_t> _sequence;
+        alignas(T) unsigned char _storage[sizeof(T)];
+
+        auto value() noexcept -> T* { return std::launder(reinterpret_cast<T*>(_storage)); }
+    };
+
+    struct alignas(CACHE_LINE) Position
+    {
+        std::atomic<size_t> _value{0};
+    };
+
+    struct alignas(CACHE_LINE) Waiters
+    {
+        std::mutex _lock;
+        std::condition_variable _cv;
+        std::atomic<uint32_t> _count{0};
+    };
+
+    const size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+    Position _tail;     ///< Next position to push to
+    Position _head;     ///< Next position to pop from
+    Waiters _producers;
+    Waiters _consumers;
+    std::atomic<bool> _closed{false};
+
+public :
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of queued items, rounded up to a power of 2 (at least 2)
+     */
+    explicit MpmcQueue(size_t capacity)
+        : _mask(round_up(capacity) - 1)
+        , _slots(new Slot[_mask + 1])
+    {
+        for(size_t i = 0; i <= _mask; ++i) { _slots[i]._sequence.store(i, std::memory_order_relaxed); }
+    }
+
+    ~MpmcQueue()
+    {
+        const size_t tail = _tail._value.load(std::memory_order_relaxed);
+        for(size_t position = _head._value.load(std::memory_order_relaxed); position != tail; ++position)
+        {
+            Slot& slot = _slots[position & _mask];
+            if(slot._sequence.load(std::memory_order_relaxed) == position + 1) { slot.value()->~T(); }
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+public :
+    auto capacity() const noexcept -> size_t { return _mask + 1; }
+
+    /**
+     * @brief Gets the number of queued items.
+     * @note Only a hint while other threads push or pop.
+     */
+    auto size() const noexcept -> size_t
+    {
+        const size_t head = _head._value.load(std::memory_order_relaxed);
+        const size_t tail = _tail._value.load(std::memory_order_relaxed);
+        return tail > head ? std::min(tail - head, capacity()) : 0;
+    }
+
+    auto empty() const noexcept -> bool { return size() == 0; }
+
+    /**
+     * @brief Constructs an item in place if the queue is not full.
+     * @return False if the queue is full or closed; the arguments are left untouched.
+     */
+    template <typename... Args>
+    auto try_emplace(Args&&... args) -> bool
+    {
+        if(_closed.load(std::memory_order_relaxed)) { return false; }
+
+        Slot* slot = nullptr;
+        size_t position = _tail._value.load(std::memory_order_relaxed);
+        while(true)
+        {
+            slot = &_slots[position & _mask];
+            const size_t sequence = slot->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if(diff == 0)
+            {
+                if(_tail._value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+            }
+            else if(diff < 0) { return false; }
+            else { position = _tail._value.load(std::memory_order_relaxed); }
+        }
+
+        new (slot->_storage) T(std::forward<Args>(args)...);
+        slot->_sequence.store(position + 1, std::memory_order_release);
+        wake(_consumers);
+        return true;
+    }
+
+    auto try_push(const T& value) -> bool { return try_emplace(value); }
+    auto try_push(T&& value) -> bool { return try_emplace(std::move(value)); }
+
+    /**
+     * @brief Constructs an item in place, waiting while the queue is full.
+     * @return False if the queue was closed before the item could be queued.
+     */
+    template <typename... Args>
+    auto emplace(Args&&... args) -> bool
+    {
+        for(uint32_t spins = 0; ; ++spins)
+        {
+            if(try_emplace(std::forward<Args>(args)...)) { return true; }
+            if(_closed.load(std::memory_order_relaxed)) { return false; }
+            if(spins < SPIN_COUNT)
+            {
+                utils::cpu_relax();
+                continue;
+            }
+            wait(_producers, [this]() { return !full(); });
+        }
+    }
+
+    auto push(const T& value) -> bool { return emplace(value); }
+    auto push(T&& value) -> bool { return emplace(std::move(value)); }
+
+    /**
+     * @brief Takes the oldest item if the queue is not empty.
+     * @return False if the queue is empty.
+     */
+    auto try_pop(T& value) -> bool
+    {
+        if(!try_pop_impl(value)) { return false; }
+        wake(_producers);
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest item, waiting while the queue is empty.
+     * @return False once the queue is closed and empty.
+     */
+    auto pop(T& value) -> bool
+    {
+        for(uint32_t spins = 0; ; ++spins)
+        {
+            if(try_pop(value)) { return true; }
+            if(_closed.load(std::memory_order_acquire) && empty()) { return false; }
+            if(spins < SPIN_COUNT)
+            {
+                utils::cpu_relax();
+                continue;
+            }
+            wait(_consumers, [this]() { return !empty(); });
+        }
+    }
+
+    /**
+     * @brief Moves up to @p count items into the queue with a single claim.
+     * @param first Iterator to the first item, the items are moved from
+     * @param count Number of items available at @p first
+     * @return Number of items queued, the leading ones of the batch. 0 if the queue is full or closed.
+     */
+    template <typename Iterator>
+    auto push_n(Iterator first, size_t count) -> size_t
+    {
+        if(count == 0 || _closed.load(std::memory_order_relaxed)) { return 0; }
+
+        size_t position = _tail._value.load(std::memory_order_relaxed);
+        size_t claimed = 0;
+        while(true)
+        {
+            // Count the consecutive free slots from the current position
+            claimed = 0;
+            while(claimed < count)
+            {
+                const size_t sequence = _slots[(position + claimed) & _mask]._sequence.load(std::memory_order_acquire);
+                if(sequence != position + claimed) { break; }
+                ++claimed;
+            }
+            if(claimed == 0)
+            {
+                const size_t current = _tail._value.load(std::memory_order_relaxed);
+                if(current == position) { return 0; }
+                position = current;
+                continue;
+            }
+            if(_tail._value.compare_exchange_weak(position, position + claimed, std::memory_order_relaxed)) { break; }
+        }
+
+        for(size_t i = 0; i < claimed; ++i, ++first)
+        {
+            Slot& slot = _slots[(position + i) & _mask];
+            new (slot._storage) T(std::move(*first));
+            slot._sequence.store(position + i + 1, std::memory_order_release);
+        }
+        wake(_consumers, claimed);
+        return claimed;
+    }
+
+    /**
+     * @brief Takes up to @p count of the oldest items with a single claim.
+     * @param out Output iterator the items are moved to
+     * @param count Maximum number of items to take
+     * @return Number of items taken, 0 if the queue is empty.
+     */
+    template <typename OutputIterator>
+    auto pop_n(OutputIterator out, size_t count) -> size_t
+    {
+        if(count == 0) { return 0; }
+
+        size_t position = _head._value.load(std::memory_order_relaxed);
+        size_t claimed = 0;
+        while(true)
+        {
+            claimed = 0;
+            while(claimed < count)
+            {
+                const size_t sequence = _slots[(position + claimed) & _mask]._sequence.load(std::memory_order_acquire);
+                if(sequence != position + claimed + 1) { break; }
+                ++claimed;
+            }
+            if(claimed == 0)
+            {
+                const size_t current = _head._value.load(std::memory_order_relaxed);
+                if(current == position) { return 0; }
+                position = current;
+                continue;
+            }
+            if(_head._value.compare_exchange_weak(position, position + claimed, std::memory_order_relaxed)) { break; }
+        }
+
+        for(size_t i = 0; i < claimed; ++i, ++out)
+        {
+            Slot& slot = _slots[(position + i) & _mask];
+            *out = std::move(*slot.value());
+            slot.value()->~T();
+            slot._sequence.store(position + i + _mask + 1, std::memory_order_release);
+        }
+        wake(_producers, claimed);
+        return claimed;
+    }
+
+    /**
+     * @brief Closes the queue.
+     *
+     * Further pushes fail and blocked producers return false. Consumers can still
+     * take the queued items; pop() returns false once the queue is drained.
+     */
+    auto close() -> void
+    {
+        _closed.store(true, std::memory_order_release);
+        for(auto* waiters : {&_producers, &_consumers})
+        {
+            { std::lock_guard<std::mutex> lock(waiters->_lock); }
+            waiters->_cv.notify_all();
+        }
+    }
+
+    auto is_closed() const noexcept -> bool { return _closed.load(std::memory_order_acquire); }
+
+private :
+    static constexpr auto round_up(size_t capacity) noexcept -> size_t
+    {
+        size_t size = 2;
+        while(size < capacity) { size <<= 1; }
+        return size;
+    }
+
+    auto full() const noexcept -> bool
+    {
+        const size_t tail = _tail._value.load(std::memory_order_relaxed);
+        return _slots[tail & _mask]._sequence.load(std::memory_order_acquire) != tail;
+    }
+
+    auto try_pop_impl(T& value) -> bool
+    {
+        Slot* slot = nullptr;
+        size_t position = _head._value.load(std::memory_order_relaxed);
+        while(true)
+        {
+            slot = &_slots[position & _mask];
+            const size_t sequence = slot->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if(diff == 0)
+            {
+                if(_head._value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+            }
+            else if(diff < 0) { return false; }
+            else { position = _head._value.load(std::memory_order_relaxed); }
+        }
+
+        value = std::move(*slot->value());
+        slot->value()->~T();
+        slot->_sequence.store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename Predicate>
+    auto wait(Waiters& waiters, Predicate ready) -> void
+    {
+        // The count is raised before the predicate is checked under the lock, so a thread
+        // that changes the queue afterwards sees the waiter and notifies under the lock
+        waiters._count.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(waiters._lock);
+            waiters._cv.wait(lock, [this, &ready]() { return ready() || _closed.load(); });
+        }
+        waiters._count.fetch_sub(1);
+    }
+
+    auto wake(Waiters& waiters, size_t count = 1) -> void
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(waiters._count.load(std::memory_order_relaxed) == 0) { return; }
+
+        { std::lock_guard<std::mutex> lock(waiters._lock); }
+        if(count > 1) { waiters._cv.notify_all(); }
+        else { waiters._cv.notify_one(); }
+    }
+};
+} // namespace common
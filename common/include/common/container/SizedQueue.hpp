@@ -24,41 +24,319 @@ SOFTWARE.
 
 #pragma once
 
-#include <queue>
+#include "common/CommonHeader.hpp"
+#include "common/container/Span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <new>
 #include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace common
 {
-template <typename _tp, uint64_t _size>
+/**
+ * @class SizedQueue
+ * @brief Fixed capacity ring that drops its oldest element when a new one is pushed while full
+ *
+ * Elements live in inline storage sized at compile time, so pushing never allocates.
+ * This makes the queue suitable as a sliding window over a stream of samples.
+ *
+ * The contents are stored in at most two contiguous runs. spans() returns both runs
+ * without copying. linearize() rotates the storage so the whole window becomes one
+ * contiguous run that can be handed to vectorized code.
+ *
+ * @tparam _tp Element type.
+ * @tparam _size Maximum number of elements.
+ * @tparam _seqlock When true, selects the single writer / multiple reader variant below.
+ */
+template <typename _tp, uint64_t _size, bool _seqlock = false>
 class SizedQueue
 {
     static_assert(_size != 0, "Size of the buffer must be greater than zero.");
 
 private :
-    std::queue<_tp> _q;
+    alignas(_tp) unsigned char _storage[sizeof(_tp) * _size];
+    size_t _head = 0;
+    size_t _count = 0;
 
 public :
+    SizedQueue() = default;
+    ~SizedQueue() { clear(); }
+
+    SizedQueue(const SizedQueue& other)
+    {
+        for(size_t i = 0; i < other._count; ++i) { emplace_back(other[i]); }
+    }
+
+    SizedQueue(SizedQueue&& other) noexcept(std::is_nothrow_move_constructible_v<_tp>)
+    {
+        for(size_t i = 0; i < other._count; ++i) { emplace_back(std::move(other[i])); }
+        other.clear();
+    }
+
+    auto operator=(const SizedQueue& other) -> SizedQueue&
+    {
+        if(this != &other)
+        {
+            clear();
+            for(size_t i = 0; i < other._count; ++i) { emplace_back(other[i]); }
+        }
+        return *this;
+    }
+
+    auto operator=(SizedQueue&& other) noexcept(std::is_nothrow_move_constructible_v<_tp>) -> SizedQueue&
+    {
+        if(this != &other)
+        {
+            clear();
+            for(size_t i = 0; i < other._count; ++i) { emplace_back(std::move(other[i])); }
+            other.clear();
+        }
+        return *this;
+    }
+
     auto front() -> const _tp&
     { 
-        return _q.front(); 
+        return *slot(_head); 
     }
 
     auto back() -> const _tp&
     { 
-        return _q.back(); 
+        return *slot(wrap(_head + _count - 1)); 
     }
 
-    auto empty() -> bool { return _q.empty(); }
-    auto size() -> size_t { return _q.size(); }
+    auto empty() const -> bool { return _count == 0; }
+    auto full() const -> bool { return _count == _size; }
+    auto size() const -> size_t { return _count; }
+    static constexpr auto capacity() -> size_t { return _size; }
+
+    /**
+     * @brief Element at the given position, 0 being the oldest
+     */
+    auto operator[](size_t index) -> _tp& { return *slot(wrap(_head + index)); }
+    auto operator[](size_t index) const -> const _tp& { return *slot(wrap(_head + index)); }
 
     auto push_back(const _tp& x) -> void { emplace_back(x); }
     auto push_back(_tp&& x) -> void { emplace_back(std::move(x)); }
-    template <typename ...Args> auto push_back(Args&&... args) -> void { emplace_back(args...); }
-    template <typename ...Args> auto emplace_back(Args&&... args) -> void { 
-        if(_q.size() == _size) { _q.pop(); }
-        _q.emplace(args...); 
+    template <typename ...Args> auto push_back(Args&&... args) -> void { emplace_back(std::forward<Args>(args)...); }
+    template <typename ...Args> auto emplace_back(Args&&... args) -> void
+    {
+        // Dropping the oldest frees the slot right behind the tail, so a throwing constructor
+        // leaves a consistent queue that simply lost its oldest element
+        if(_count == _size) { pop_front(); }
+        new (slot(wrap(_head + _count))) _tp(std::forward<Args>(args)...);
+        ++_count;
+    }
+
+    auto pop_front() -> void
+    {
+        slot(_head)->~_tp();
+        _head = wrap(_head + 1);
+        --_count;
+    }
+
+    auto clear() -> void
+    {
+        while(_count != 0) { pop_front(); }
+        _head = 0;
+    }
+
+    /**
+     * @brief Contents as two contiguous runs, oldest first
+     *
+     * The second run is empty unless the contents wrap around the end of the storage.
+     */
+    auto spans() const -> std::pair<Span<const _tp>, Span<const _tp>>
+    {
+        const size_t first = std::min<size_t>(_count, _size - _head);
+        return {Span<const _tp>{slot(_head), first}, Span<const _tp>{slot(0), _count - first}};
+    }
+
+    /**
+     * @brief Rearranges the storage so that the contents form a single contiguous run
+     *
+     * Costs nothing while the contents do not wrap, otherwise moves every element once.
+     * Pushing afterwards may split the contents again.
+     *
+     * @return View of the contents, oldest first
+     */
+    auto linearize() -> Span<_tp>
+    {
+        if(_head + _count > _size)
+        {
+            const size_t tail = _head + _count - _size;
+            if(_count < _size)
+            {
+                // Close the gap between the two runs so that every slot in [0, _count) is alive
+                for(size_t i = 0; i < _size - _head; ++i)
+                {
+                    _tp* source = slot(_head + i);
+                    new (slot(tail + i)) _tp(std::move(*source));
+                    source->~_tp();
+                }
+            }
+            std::rotate(slot(0), slot(tail), slot(_count));
+            _head = 0;
+        }
+        return Span<_tp>{slot(_head), _count};
+    }
+
+private :
+    static auto wrap(size_t index) -> size_t { return index >= _size ? index - _size : index; }
+    auto slot(size_t index) -> _tp* { return std::launder(reinterpret_cast<_tp*>(_storage) + index); }
+    auto slot(size_t index) const -> const _tp* { return std::launder(reinterpret_cast<const _tp*>(_storage) + index); }
+};
+
+/**
+ * @class SizedQueue
+ * @brief Seqlock variant for one writer thread and any number of reader threads
+ *
+ * The writer never waits for readers. Every change makes the sequence counter odd
+ * while it is in progress and even once it is complete. A reader copies the whole
+ * window and retries if the counter was odd or moved in the meantime, so a snapshot
+ * is always a window that actually existed.
+ *
+ * Elements are kept as relaxed atomic words so concurrent reads are well defined,
+ * which limits this variant to trivially copyable types.
+ */
+template <typename _tp, uint64_t _size>
+class SizedQueue<_tp, _size, true>
+{
+    static_assert(_size != 0, "Size of the buffer must be greater than zero.");
+    static_assert(std::is_trivially_copyable_v<_tp>, "Seqlock mode requires a trivially copyable type.");
+
+private :
+    static constexpr size_t WORDS = (sizeof(_tp) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    using Slot = std::array<std::atomic<uint64_t>, WORDS>;
+
+    std::atomic<uint64_t> _sequence{0};
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _count{0};
+    std::array<Slot, _size> _slots{};
+
+public :
+    SizedQueue() = default;
+    SizedQueue(const SizedQueue&) = delete;
+    auto operator=(const SizedQueue&) -> SizedQueue& = delete;
+
+    auto empty() const -> bool { return size() == 0; }
+    auto size() const -> size_t { return _count.load(std::memory_order_relaxed); }
+    static constexpr auto capacity() -> size_t { return _size; }
+
+    /**
+     * @brief Newest element. Must only be called by the writer thread on a non-empty queue
+     */
+    auto back() const -> _tp
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        return load(_slots[wrap(head + _count.load(std::memory_order_relaxed) - 1)]);
     }
 
-    auto pop_front() -> void { _q.pop(); }
+    auto push_back(const _tp& x) -> void { emplace_back(x); }
+    template <typename ...Args> auto emplace_back(Args&&... args) -> void
+    {
+        const _tp value(std::forward<Args>(args)...);
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t count = _count.load(std::memory_order_relaxed);
+
+        begin_write();
+        if(count == _size)
+        {
+            store(_slots[head], value);
+            _head.store(wrap(head + 1), std::memory_order_relaxed);
+        }
+        else
+        {
+            store(_slots[wrap(head + count)], value);
+            _count.store(count + 1, std::memory_order_relaxed);
+        }
+        end_write();
+    }
+
+    auto pop_front() -> void
+    {
+        begin_write();
+        _head.store(wrap(_head.load(std::memory_order_relaxed) + 1), std::memory_order_relaxed);
+        _count.store(_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        end_write();
+    }
+
+    auto clear() -> void
+    {
+        begin_write();
+        _head.store(0, std::memory_order_relaxed);
+        _count.store(0, std::memory_order_relaxed);
+        end_write();
+    }
+
+    /**
+     * @brief Copies a consistent view of the contents, oldest first
+     *
+     * May be called from any thread while the writer keeps pushing.
+     *
+     * @param out Destination with room for capacity() elements
+     * @return Number of elements copied
+     */
+    auto snapshot(_tp* out) const -> size_t
+    {
+        while(true)
+        {
+            const uint64_t before = _sequence.load(std::memory_order_acquire);
+            if(before & 1)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            const size_t head = _head.load(std::memory_order_relaxed);
+            const size_t count = std::min<size_t>(_count.load(std::memory_order_relaxed), _size);
+            for(size_t i = 0; i < count; ++i) { out[i] = load(_slots[wrap(head + i)]); }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(_sequence.load(std::memory_order_relaxed) == before) { return count; }
+        }
+    }
+
+    auto snapshot(std::array<_tp, _size>& out) const -> size_t { return snapshot(out.data()); }
+
+    /**
+     * @brief Number of completed changes, useful to skip snapshots when nothing moved
+     */
+    auto version() const -> uint64_t { return _sequence.load(std::memory_order_acquire) >> 1; }
+
+private :
+    static auto wrap(size_t index) -> size_t { return index >= _size ? index - _size : index; }
+
+    auto begin_write() -> void
+    {
+        _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    auto end_write() -> void
+    {
+        _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    static auto store(Slot& slot, const _tp& value) -> void
+    {
+        uint64_t words[WORDS] = {};
+        std::memcpy(words, &value, sizeof(_tp));
+        for(size_t i = 0; i < WORDS; ++i) { slot[i].store(words[i], std::memory_order_relaxed); }
+    }
+
+    static auto load(const Slot& slot) -> _tp
+    {
+        uint64_t words[WORDS];
+        for(size_t i = 0; i < WORDS; ++i) { words[i] = slot[i].load(std::memory_order_relaxed); }
+        _tp value;
+        std::memcpy(&value, words, sizeof(_tp));
+        return value;
+    }
 };
 } // namespace common
@@ -0,0 +1,54 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+
+#include <cstddef>
+
+namespace common
+{
+/**
+ * @brief Non-owning view of a contiguous run of elements
+ *
+ * A minimal stand-in for C++20 std::span, used to hand out zero-copy regions of
+ * ring buffers.
+ *
+ * @tparam T Element type, const qualified for read-only views.
+ */
+template <typename T>
+struct Span
+{
+    T* _data = nullptr;
+    size_t _size = 0;
+
+    auto data() const noexcept -> T* { return _data; }
+    auto size() const noexcept -> size_t { return _size; }
+    auto empty() const noexcept -> bool { return _size == 0; }
+    auto begin() const noexcept -> T* { return _data; }
+    auto end() const noexcept -> T* { return _data + _size; }
+    auto operator[](size_t index) const noexcept -> T& { return _data[index]; }
+};
+} // namespace common
@@ -0,0 +1,350 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/container/Span.hpp"
+#include "common/threading/WaitEvent.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace common
+{
+/**
+ * @class SpscQueue
+ * @brief Bounded wait-free queue for exactly one producer and one consumer thread
+ *
+ * A power-of-two ring with monotonically increasing head and tail indices. Each side
+ * keeps a private copy of the other side's index and reloads it only when the ring
+ * looks full (producer) or empty (consumer), so in steady state a push or pop touches
+ * no cache line written by the other thread apart from the slot itself.
+ *
+ * Items are constructed in place with try_emplace(). For trivially copyable types
+ * the free and filled regions can also be accessed without copying through
+ * write_span() / commit_write() and read_span() / commit_read(), and copied in bulk
+ * with write() / read(), which suits byte streams.
+ *
+ * A queue created with blocking enabled lets the consumer sleep in wait() on a
+ * threading::WaitEvent (an eventfd on Linux). The producer then pays one fence per
+ * push and a system call only when the consumer is actually asleep.
+ *
+ * @tparam T Element type. Must be move constructible and move assignable.
+ */
+template <typename T>
+class SpscQueue
+{
+private :
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Storage
+    {
+        alignas(T) unsigned char _bytes[sizeof(T)];
+    };
+
+    struct alignas(CACHE_LINE) Producer
+    {
+        std::atomic<size_t> _tail{0};
+        size_t _headCache = 0;
+    };
+
+    struct alignas(CACHE_LINE) Consumer
+    {
+        std::atomic<size_t> _head{0};
+        size_t _tailCache = 0;
+    };
+
+    struct alignas(CACHE_LINE) Sleeper
+    {
+        std::atomic<bool> _waiting{false};
+    };
+
+    const size_t _mask;
+    std::unique_ptr<Storage[]> _slots;
+    std::unique_ptr<threading::WaitEvent> _event;
+    Producer _producer;
+    Consumer _consumer;
+    Sleeper _sleeper;
+
+public :
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of queued items, rounded up to a power of 2
+     * @param blocking Enables wait() for the consumer
+     */
+    explicit SpscQueue(size_t capacity, bool blocking = false)
+        : _mask(round_up(capacity) - 1)
+        , _slots(new Storage[_mask + 1])
+        , _event(blocking ? std::make_unique<threading::WaitEvent>() : nullptr)
+    {
+    }
+
+    ~SpscQueue()
+    {
+        if constexpr(!std::is_trivially_destructible_v<T>)
+        {
+            const size_t tail = _producer._tail.load(std::memory_order_relaxed);
+            for(size_t head = _consumer._head.load(std::memory_order_relaxed); head != tail; ++head)
+            {
+                slot(head)->~T();
+            }
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+public :
+    auto capacity() const noexcept -> size_t { return _mask + 1; }
+
+    /**
+     * @brief Gets the number of queued items.
+     * @note Exact only when called from the producer or the consumer thread.
+     */
+    auto size() const noexcept -> size_t
+    {
+        return _producer._tail.load(std::memory_order_acquire) - _consumer._head.load(std::memory_order_acquire);
+    }
+
+    auto empty() const noexcept -> bool { return size() == 0; }
+
+    // ---- Producer side ----
+
+    /**
+     * @brief Constructs an item in place if the queue is not full.
+     * @return False if the queue is full; the arguments are left untouched.
+     */
+    template <typename... Args>
+    auto try_emplace(Args&&... args) -> bool
+    {
+        const size_t tail = _producer._tail.load(std::memory_order_relaxed);
+        if(tail - _producer._headCache > _mask)
+        {
+            _producer._headCache = _consumer._head.load(std::memory_order_acquire);
+            if(tail - _producer._headCache > _mask) { return false; }
+        }
+
+        new (slot(tail)) T(std::forward<Args>(args)...);
+        publish(tail + 1);
+        return true;
+    }
+
+    auto try_push(const T& value) -> bool { return try_emplace(value); }
+    auto try_push(T&& value) -> bool { return try_emplace(std::move(value)); }
+
+    /**
+     * @brief Gets the contiguous free region at the tail of the ring.
+     * @param max Largest region to return
+     * @return The region to fill, empty if the queue is full. At the end of the ring
+     *         the region stops at the wrap-around; call again after commit_write().
+     */
+    auto write_span(size_t max = SIZE_MAX) noexcept -> Span<T>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "write_span() requires a trivially copyable type");
+        const size_t tail = _producer._tail.load(std::memory_order_relaxed);
+        size_t free = capacity() - (tail - _producer._headCache);
+        if(free < max)
+        {
+            _producer._headCache = _consumer._head.load(std::memory_order_acquire);
+            free = capacity() - (tail - _producer._headCache);
+        }
+        const size_t contiguous = std::min(free, capacity() - (tail & _mask));
+        return {slot(tail), std::min(contiguous, max)};
+    }
+
+    /**
+     * @brief Publishes the first @p count items of the last write_span().
+     */
+    auto commit_write(size_t count) noexcept -> void
+    {
+        if(count == 0) { return; }
+        publish(_producer._tail.load(std::memory_order_relaxed) + count);
+    }
+
+    /**
+     * @brief Copies as many items as fit into the queue.
+     * @return Number of items copied.
+     */
+    auto write(const T* data, size_t count) noexcept -> size_t
+    {
+        size_t written = 0;
+        while(written < count)
+        {
+            const auto span = write_span(count - written);
+            if(span.empty()) { break; }
+            std::memcpy(static_cast<void*>(span.data()), data + written, span.size() * sizeof(T));
+            commit_write(span.size());
+            written += span.size();
+        }
+        return written;
+    }
+
+    // ---- Consumer side ----
+
+    /**
+     * @brief Gets the oldest item without removing it.
+     * @return Pointer to the item, nullptr if the queue is empty.
+     */
+    auto front() noexcept -> T*
+    {
+        const size_t head = _consumer._head.load(std::memory_order_relaxed);
+        if(!available(head, 1)) { return nullptr; }
+        return slot(head);
+    }
+
+    /**
+     * @brief Removes the item returned by front().
+     */
+    auto pop() noexcept -> void
+    {
+        const size_t head = _consumer._head.load(std::memory_order_relaxed);
+        slot(head)->~T();
+        _consumer._head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Takes the oldest item if the queue is not empty.
+     * @return False if the queue is empty.
+     */
+    auto try_pop(T& value) -> bool
+    {
+        T* item = front();
+        if(!item) { return false; }
+        value = std::move(*item);
+        pop();
+        return true;
+    }
+
+    /**
+     * @brief Gets the contiguous filled region at the head of the ring.
+     * @param max Largest region to return
+     * @return The region to read, empty if the queue is empty. At the end of the ring
+     *         the region stops at the wrap-around; call again after commit_read().
+     */
+    auto read_span(size_t max = SIZE_MAX) noexcept -> Span<const T>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "read_span() requires a trivially copyable type");
+        const size_t head = _consumer._head.load(std::memory_order_relaxed);
+        available(head, max);
+        const size_t filled = _consumer._tailCache - head;
+        const size_t contiguous = std::min(filled, capacity() - (head & _mask));
+        return {slot(head), std::min(contiguous, max)};
+    }
+
+    /**
+     * @brief Releases the first @p count items of the last read_span().
+     */
+    auto commit_read(size_t count) noexcept -> void
+    {
+        _consumer._head.store(_consumer._head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies up to @p count items out of the queue.
+     * @return Number of items copied.
+     */
+    auto read(T* data, size_t count) noexcept -> size_t
+    {
+        size_t copied = 0;
+        while(copied < count)
+        {
+            const auto span = read_span(count - copied);
+            if(span.empty()) { break; }
+            std::memcpy(static_cast<void*>(data + copied), span.data(), span.size() * sizeof(T));
+            commit_read(span.size());
+            copied += span.size();
+        }
+        return copied;
+    }
+
+    /**
+     * @brief Waits until the queue holds an item.
+     * 
+     * Without blocking enabled the consumer yields in a loop instead of sleeping.
+     * 
+     * @param timeout Longest time to wait.
+     * @return True if an item is available, false on timeout.
+     */
+    auto wait(std::chrono::nanoseconds timeout) -> bool
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while(!available(_consumer._head.load(std::memory_order_relaxed), 1))
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if(now >= deadline) { return false; }
+            if(!_event)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Announce the sleep before the last check, publish() checks the flag after its store
+            _sleeper._waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(!available(_consumer._head.load(std::memory_order_relaxed), 1)) { _event->wait_for(deadline - now); }
+            _sleeper._waiting.store(false, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+private :
+    static constexpr auto round_up(size_t capacity) noexcept -> size_t
+    {
+        size_t size = 1;
+        while(size < capacity) { size <<= 1; }
+        return size;
+    }
+
+    auto slot(size_t index) const noexcept -> T*
+    {
+        return std::launder(reinterpret_cast<T*>(_slots[index & _mask]._bytes));
+    }
+
+    auto publish(size_t tail) noexcept -> void
+    {
+        _producer._tail.store(tail, std::memory_order_release);
+        if(!_event) { return; }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(_sleeper._waiting.load(std::memory_order_relaxed)) { _event->notify(); }
+    }
+
+    /// @brief Checks for @p count filled slots, reloading the cached tail if needed.
+    auto available(size_t head, size_t count) noexcept -> bool
+    {
+        if(_consumer._tailCache - head >= count) { return true; }
+        _consumer._tailCache = _producer._tail.load(std::memory_order_acquire);
+        return _consumer._tailCache - head >= count;
+    }
+};
+} // namespace common
@@ -24,15 +24,29 @@ SOFTWARE.
 
 #pragma once
 
-#include <deque>
+#include "common/container/CircularDeque.hpp"
+#include "common/threading/Task.hpp"
+
 #include <memory>
 #include <thread>
 #include <future>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
 
 #include <iostream>
 
 namespace common
 {
+/**
+ * @brief A queued task together with the time it was queued at
+ */
+struct QueuedTask
+{
+    threading::Task _task;
+    int64_t _enqueued = 0; ///< steady clock time in nanoseconds, 0 if not recorded
+};
+
 /**
  * @class WorkQueue
  * @brief A thread-safe work queue for task management in thread pools
@@ -40,14 +54,29 @@ namespace common
  * WorkQueue provides a thread-safe container for storing and managing tasks
  * that can be executed by worker threads. It supports both FIFO task retrieval
  * and work-stealing from the back of the queue for load balancing.
+ * Tasks are kept in a CircularDeque, so a queue that has reached its working size
+ * does not allocate on push or pop.
+ * 
+ * A queue can be split into a fixed number of lanes. Lane 0 has the highest
+ * priority: pop() and try_steal() only look at a lane once all lanes before it
+ * are empty.
  */
 class WorkQueue
 {
 private :
-    std::deque<std::function<void()>> _tasks;
+    std::vector<CircularDeque<QueuedTask>> _lanes;
+    size_t _size = 0;
     mutable std::mutex _lock;
     std::condition_variable _cv;
     
+public :
+    /**
+     * @brief Constructor
+     * @param laneCount Number of priority lanes, at least 1
+     */
+    explicit WorkQueue(size_t laneCount = 1)
+        : _lanes(laneCount > 0 ? laneCount : 1) {}
+
 public :          
     /**
      * @brief Adds a task to the work queue
@@ -55,48 +84,115 @@ public :
      * @param task The task function to be executed
      * @return A future object that can be used to retrieve the task result
      * 
-     * Wraps the task in a packaged_task and adds it to the queue. The task
+     * Wraps the task with threading::make_task() and adds it to the queue. The task
      * will be executed asynchronously by a worker thread. Returns a future
      * that can be used to wait for completion and retrieve the result.
      */
-    template <typename ReturnType>
-    auto push(std::function<ReturnType()>&& task) noexcept -> std::future<ReturnType>
+    template <typename ReturnType, typename Function>
+    auto push(Function&& task) noexcept -> std::future<ReturnType>
+    {
+        auto [wrapped, future] = threading::make_task<ReturnType>(std::forward<Function>(task));
+        push(std::move(wrapped));
+        return std::move(future);
+    }
+
+    /**
+     * @brief Adds an already wrapped task to the work queue
+     * @param task The task to be executed
+     * @param lane The lane to add the task to
+     * @param enqueued Time the task was queued at, see QueuedTask
+     */
+    auto push(threading::Task&& task, size_t lane = 0, int64_t enqueued = 0) noexcept -> void
     {
-        using TaskType = std::packaged_task<ReturnType()>;
-        
-        auto packagedTask = std::make_shared<TaskType>(std::move(task));
-        std::future<ReturnType> future = packagedTask->get_future();
         {
             std::lock_guard<std::mutex> lock(_lock);
-            _tasks.emplace_back([task = std::move(packagedTask)]() { 
-                (*task)(); 
-            });
+            _lanes[lane].push_back({std::move(task), enqueued});
+            ++_size;
         }
         
         _cv.notify_one();
-        return future;
     }
 
     /**
-     * @brief Retrieves and removes a task from the front of the queue
+     * @brief Adds a batch of already wrapped tasks to the work queue
+     * @param tasks Pointer to the first task, the tasks are moved out
+     * @param count Number of tasks
+     * @param lane The lane to add the tasks to
+     * @param enqueued Time the tasks were queued at, see QueuedTask
+     * 
+     * All tasks are appended under a single lock and the waiting worker is
+     * notified once for the whole batch.
+     */
+    auto push_bulk(threading::Task* tasks, size_t count, size_t lane = 0, int64_t enqueued = 0) noexcept -> void
+    {
+        if(count == 0) { return; }
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            for(size_t i = 0; i < count; ++i) { _lanes[lane].push_back({std::move(tasks[i]), enqueued}); }
+            _size += count;
+        }
+
+        _cv.notify_one();
+    }
+
+    /**
+     * @brief Retrieves and removes the first task of the highest priority lane
      * @param running Reference to atomic boolean indicating if the system is running
-     * @return A task function to execute, or nullptr if the queue is empty and system is stopping
+     * @param lane Set to the lane the task was taken from
+     * @return A task to execute, or an empty task if the queue is empty and system is stopping
      * 
      * Blocks until a task is available or the system stops running. Uses condition
      * variable to efficiently wait for new tasks. Returns the first task in FIFO order.
      */
-    auto pop(const std::atomic<bool>& running) -> std::function<void()>
+    auto pop(const std::atomic<bool>& running, size_t& lane) -> QueuedTask
     {
         std::unique_lock<std::mutex> lock(_lock);
         _cv.wait(lock, [this, &running]() {
-            return !_tasks.empty() || !running.load();
+            return _size > 0 || !running.load();
         });
         
-        if(_tasks.empty()) { return nullptr; }
-        
-        auto task = std::move(_tasks.front());
-        _tasks.pop_front();
-        return task;
+        for(lane = 0; lane < _lanes.size(); ++lane)
+        {
+            if(!_lanes[lane].empty())
+            {
+                --_size;
+                return _lanes[lane].pop_front();
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Retrieves and removes the first task of the highest priority lane without waiting
+     * @param lane Set to the lane the task was taken from
+     * @return A task to execute, or an empty task if the queue is empty
+     */
+    auto try_pop(size_t& lane) -> QueuedTask
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(_size == 0) { return {}; }
+
+        for(lane = 0; lane < _lanes.size(); ++lane)
+        {
+            if(!_lanes[lane].empty())
+            {
+                --_size;
+                return _lanes[lane].pop_front();
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Blocks until the queue holds a task or the system stops running
+     * @param running Reference to atomic boolean indicating if the system is running
+     */
+    auto wait(const std::atomic<bool>& running) -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _cv.wait(lock, [this, &running]() {
+            return _size > 0 || !running.load();
+        });
     }
 
     /**
@@ -109,27 +205,34 @@ public :
     auto empty() const -> bool
     {
         std::lock_guard<std::mutex> lock(_lock);
-        return _tasks.empty();
+        return _size == 0;
     }
 
     /**
-     * @brief Attempts to steal a task from the back of the queue
-     * @return A task function to execute, or nullptr if unsuccessful
+     * @brief Attempts to steal a task from the back of the highest priority lane
+     * @param lane Set to the lane the task was taken from
+     * @return A task to execute, or an empty task if unsuccessful
      * 
      * Non-blocking operation that attempts to acquire the lock and steal
      * a task from the back of the queue. Used for work-stealing load balancing.
-     * Returns nullptr if lock cannot be acquired or queue is empty.
+     * Returns an empty task if lock cannot be acquired or queue is empty.
      */
-    auto try_steal() -> std::function<void()>
+    auto try_steal(size_t& lane) -> QueuedTask
     {
         std::unique_lock<std::mutex> lock(_lock, std::try_to_lock);
-        if (!lock.owns_lock() || _tasks.empty()) {
-            return nullptr;
+        if (!lock.owns_lock() || _size == 0) {
+            return {};
         }
-        
-        auto task = std::move(_tasks.back());
-        _tasks.pop_back();
-        return task;
+
+        for(lane = 0; lane < _lanes.size(); ++lane)
+        {
+            if(!_lanes[lane].empty())
+            {
+                --_size;
+                return _lanes[lane].pop_back();
+            }
+        }
+        return {};
     }
 
     /**
@@ -142,7 +245,7 @@ public :
     auto size() const -> size_t
     {
         std::lock_guard<std::mutex> lock(_lock);
-        return _tasks.size();
+        return _size;
     }
     
     /**
@@ -154,7 +257,9 @@ public :
      */
     auto finalize() -> void
     {
+        // Taking the lock orders the notification after a waiter's predicate check
+        { std::lock_guard<std::mutex> lock(_lock); }
         _cv.notify_all();
     }
 };
-} // namespace common
\ No newline at end of file
+} // namespace common
@@ -0,0 +1,108 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+
+#include <cstddef>
+#include <new>
+
+namespace common::memory
+{
+/**
+ * @brief Process-wide pool of fixed-size memory blocks.
+ *
+ * Requests up to MAX_BLOCK_SIZE bytes are rounded up to a size class (64, 128, 256 or
+ * 512 bytes) and served from a per-thread cache. A thread cache exchanges blocks with a
+ * shared central list in batches, so a block that is allocated on one thread and released
+ * on another costs one lock per batch instead of one malloc per block. Larger requests are
+ * forwarded to the global operator new.
+ *
+ * @note Pooled memory is kept for reuse and never returned to the operating system.
+ */
+class COMMON_LIB_API BlockPool
+{
+public :
+    static constexpr size_t MAX_BLOCK_SIZE = 512;
+
+public :
+    /**
+     * @brief Allocates a block of at least @p size bytes.
+     *
+     * @param size Requested size in bytes.
+     * @return Pointer to memory aligned to alignof(std::max_align_t).
+     * @throws std::bad_alloc If the underlying allocation fails.
+     */
+    static auto allocate(size_t size) -> void*;
+
+    /**
+     * @brief Returns a block obtained from allocate().
+     *
+     * @param ptr Pointer returned by allocate().
+     * @param size The size that was passed to allocate().
+     */
+    static auto deallocate(void* ptr, size_t size) noexcept -> void;
+};
+
+/**
+ * @brief Standard allocator backed by BlockPool.
+ *
+ * Can be passed to allocator-aware standard types, e.g.
+ * @c std::promise<T>(std::allocator_arg, PoolAllocator<T>()) to keep the shared state
+ * of a promise/future pair out of the heap.
+ *
+ * @tparam T The value type.
+ */
+template <typename T>
+class PoolAllocator
+{
+public :
+    using value_type = T;
+
+public :
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+public :
+    auto allocate(size_t n) -> T*
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+        return static_cast<T*>(BlockPool::allocate(n * sizeof(T)));
+    }
+
+    auto deallocate(T* ptr, size_t n) noexcept -> void
+    {
+        BlockPool::deallocate(ptr, n * sizeof(T));
+    }
+
+    template <typename U>
+    auto operator==(const PoolAllocator<U>&) const noexcept -> bool { return true; }
+
+    template <typename U>
+    auto operator!=(const PoolAllocator<U>&) const noexcept -> bool { return false; }
+};
+} // namespace common::memory
@@ -0,0 +1,153 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/container/Span.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace common::memory
+{
+/**
+ * @brief Reference-counted byte buffer from a process-wide pool, with room for headers.
+ *
+ * The memory is taken from size classes of 1 KiB up to MAX_POOLED_SIZE and returned to
+ * the pool when the last Buffer referring to it goes away, so a stream of equally sized
+ * messages reuses the same few blocks. Larger buffers are allocated and freed directly.
+ *
+ * Copying a Buffer shares the bytes instead of copying them. Space is reserved in front of
+ * the data, so a header can be put in front of a payload with prepend() instead of moving
+ * the payload to a bigger buffer.
+ *
+ * @note The reference count is atomic, Buffers may be handed between threads. The bytes
+ *       themselves are not synchronized; modify them before sharing the Buffer.
+ */
+class COMMON_LIB_API Buffer
+{
+public :
+    static constexpr size_t MAX_POOLED_SIZE = 1024 * 1024;
+    static constexpr size_t DEFAULT_HEADROOM = 16;
+
+private :
+    struct Block
+    {
+        std::atomic<uint32_t> _refs;
+        uint32_t _class;
+        size_t _capacity;
+
+        auto bytes() noexcept -> uint8_t* { return reinterpret_cast<uint8_t*>(this + 1); }
+    };
+
+    Block* _block = nullptr;
+    size_t _offset = 0;
+    size_t _size = 0;
+
+public :
+    Buffer() noexcept = default;
+    Buffer(const Buffer& other) noexcept;
+    Buffer(Buffer&& other) noexcept;
+    ~Buffer() noexcept;
+
+    auto operator=(const Buffer& other) noexcept -> Buffer&;
+    auto operator=(Buffer&& other) noexcept -> Buffer&;
+
+public :
+    /**
+     * @brief Allocates a buffer of @p size uninitialized bytes.
+     *
+     * @param size Number of bytes of data.
+     * @param headroom Bytes reserved in front of the data for prepend().
+     * @return The buffer.
+     * @throws std::bad_alloc If the memory cannot be allocated.
+     */
+    static auto allocate(size_t size, size_t headroom = DEFAULT_HEADROOM) -> Buffer;
+
+    /**
+     * @brief Allocates a buffer holding a copy of the given bytes.
+     *
+     * @param data The bytes to copy.
+     * @param size Number of bytes to copy.
+     * @param headroom Bytes reserved in front of the data for prepend().
+     * @return The buffer.
+     * @throws std::bad_alloc If the memory cannot be allocated.
+     */
+    static auto copy_of(const uint8_t* data, size_t size, size_t headroom = DEFAULT_HEADROOM) -> Buffer;
+
+public :
+    inline auto data() noexcept -> uint8_t* { return _block ? _block->bytes() + _offset : nullptr; }
+    inline auto data() const noexcept -> const uint8_t* { return _block ? _block->bytes() + _offset : nullptr; }
+    inline auto size() const noexcept -> size_t { return _size; }
+    inline auto empty() const noexcept -> bool { return _size == 0; }
+    inline auto begin() const noexcept -> const uint8_t* { return data(); }
+    inline auto end() const noexcept -> const uint8_t* { return data() + _size; }
+    inline auto span() const noexcept -> Span<const uint8_t> { return {data(), _size}; }
+
+    /**
+     * @brief Bytes that are free in front of the data.
+     */
+    inline auto headroom() const noexcept -> size_t { return _offset; }
+
+    /**
+     * @brief Number of Buffers sharing the bytes, 0 for an empty Buffer.
+     */
+    inline auto use_count() const noexcept -> uint32_t { return _block ? _block->_refs.load(std::memory_order_acquire) : 0; }
+
+    /**
+     * @brief Grows the data by @p size bytes at the front, taken from the headroom.
+     *
+     * @param size Number of bytes to add in front of the data.
+     * @return Pointer to the new first byte, to be filled in by the caller.
+     * @throws OutOfRangeException If the headroom is smaller than @p size.
+     * @throws BadHandlingException If the bytes are shared with another Buffer.
+     */
+    auto prepend(size_t size) -> uint8_t*;
+
+    /**
+     * @brief Drops @p size bytes from the front of the data, e.g. a header that has been read.
+     *
+     * Only this Buffer is affected, others sharing the bytes keep their view.
+     *
+     * @throws OutOfRangeException If the data is shorter than @p size.
+     */
+    auto consume(size_t size) -> void;
+
+    /**
+     * @brief Makes a Buffer sharing @p size bytes of the data, starting at @p offset.
+     *
+     * The bytes in front of the slice count as its headroom; like any shared Buffer it can
+     * only prepend() once it is the last one referring to them.
+     *
+     * @throws OutOfRangeException If the range is not within the data.
+     */
+    auto slice(size_t offset, size_t size) const -> Buffer;
+
+    /**
+     * @brief Releases the bytes. The Buffer is empty afterwards.
+     */
+    auto reset() noexcept -> void;
+};
+} // namespace common::memory
@@ -0,0 +1,577 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/Exception.hpp"
+#include "common/memory/BlockPool.hpp"
+#include "common/threading/Task.hpp"
+#include "common/threading/TaskExecutor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace common::threading
+{
+template <typename T> class Future;
+template <typename T> class Promise;
+
+namespace detail
+{
+/// @brief Placeholder value stored by a Future<void>.
+struct Unit {};
+
+/**
+ * @brief Shared state between a Promise and its Future.
+ *
+ * Holds either a value or an exception plus at most one continuation. The
+ * continuation is posted to the executor of the state once the state becomes
+ * ready, or runs inline on the completing thread if there is no running executor.
+ */
+template <typename T>
+class FutureState final
+{
+public :
+    using Stored = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+private :
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::atomic<bool> _ready{false};
+    std::optional<Stored> _value;
+    std::exception_ptr _exception;
+    Task _continuation;
+    TaskExecutor* const _executor;
+
+public :
+    explicit FutureState(TaskExecutor* executor) noexcept
+        : _executor(executor) {}
+
+public :
+    template <typename... Args>
+    auto set_value(Args&&... args) -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if(_ready.load(std::memory_order_relaxed)) { throw BadHandlingException("promise already satisfied"); }
+        _value.emplace(std::forward<Args>(args)...);
+        complete(lock);
+    }
+
+    auto set_exception(std::exception_ptr exception) -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if(_ready.load(std::memory_order_relaxed)) { throw BadHandlingException("promise already satisfied"); }
+        _exception = std::move(exception);
+        complete(lock);
+    }
+
+    auto set_continuation(Task&& continuation) noexcept -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if(!_ready.load(std::memory_order_relaxed))
+            {
+                _continuation = std::move(continuation);
+                return;
+            }
+        }
+        dispatch(std::move(continuation));
+    }
+
+    auto is_ready() const noexcept -> bool { return _ready.load(std::memory_order_acquire); }
+
+    auto get_executor() const noexcept -> TaskExecutor* { return _executor; }
+
+    /**
+     * @brief Waits until the state is ready, running pending executor tasks meanwhile.
+     */
+    auto wait() -> void
+    {
+        while(!is_ready())
+        {
+            if(_executor && _executor->try_run_one()) { continue; }
+
+            std::unique_lock<std::mutex> lock(_lock);
+            _cv.wait_for(lock, std::chrono::milliseconds(1), [this]() { return is_ready(); });
+        }
+    }
+
+    auto take() -> T
+    {
+        wait();
+        if(_exception) { std::rethrow_exception(_exception); }
+        if constexpr (!std::is_void_v<T>) { return std::move(*_value); }
+    }
+
+private :
+    auto complete(std::unique_lock<std::mutex>& lock) noexcept -> void
+    {
+        _ready.store(true, std::memory_order_release);
+        Task continuation = std::move(_continuation);
+        lock.unlock();
+
+        _cv.notify_all();
+        if(continuation) { dispatch(std::move(continuation)); }
+    }
+
+    auto dispatch(Task&& continuation) noexcept -> void
+    {
+        if(_executor && _executor->is_running()) { _executor->post(std::move(continuation)); }
+        else { continuation(); }
+    }
+};
+
+template <typename T>
+auto make_state(TaskExecutor* executor) -> std::shared_ptr<FutureState<T>>
+{
+    return std::allocate_shared<FutureState<T>>(memory::PoolAllocator<FutureState<T>>(), executor);
+}
+
+/**
+ * @brief Stores the result of @p func, or the exception it throws, in @p state.
+ */
+template <typename T, typename Function>
+auto fulfill(FutureState<T>& state, Function&& func) noexcept -> void
+{
+    try
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            func();
+            state.set_value();
+        }
+        else { state.set_value(func()); }
+    }
+    catch(...)
+    {
+        try { state.set_exception(std::current_exception()); }
+        catch(...) {}
+    }
+}
+
+template <typename Function, typename T>
+struct ContinuationResult { using type = std::invoke_result_t<Function, T>; };
+
+template <typename Function>
+struct ContinuationResult<Function, void> { using type = std::invoke_result_t<Function>; };
+
+/// @brief Grants the free functions of this header access to the state of a Future.
+struct FutureAccess
+{
+    template <typename T>
+    static auto state(Future<T>& future) noexcept -> std::shared_ptr<FutureState<T>>& { return future._state; }
+
+    template <typename T>
+    static auto make(std::shared_ptr<FutureState<T>> state) noexcept -> Future<T> { return Future<T>(std::move(state)); }
+};
+} // namespace detail
+
+/**
+ * @class Future
+ * @brief Executor-aware future that can be chained without blocking
+ * 
+ * Unlike std::future, a Future accepts a continuation via then(). The continuation is
+ * posted to the executor as soon as the result is available, so a pipeline of stages
+ * never parks a worker thread on get(). get() remains available for the final
+ * consumer; called from any thread it runs pending executor tasks while it waits.
+ * 
+ * A Future is move-only and single-shot: get() and then() consume it.
+ *
+ * @tparam T The type of the result, may be void.
+ */
+template <typename T>
+class Future final
+{
+    template <typename U> friend class Future;
+    friend struct detail::FutureAccess;
+    friend class Promise<T>;
+
+private :
+    std::shared_ptr<detail::FutureState<T>> _state;
+
+private :
+    explicit Future(std::shared_ptr<detail::FutureState<T>> state) noexcept
+        : _state(std::move(state)) {}
+
+public :
+    Future() noexcept = default;
+    Future(Future&&) noexcept = default;
+    Future& operator=(Future&&) noexcept = default;
+    Future(const Future&) = delete;
+    Future& operator=(const Future&) = delete;
+
+public :
+    /**
+     * @brief Checks whether the future refers to a shared state.
+     */
+    inline auto valid() const noexcept -> bool { return _state != nullptr; }
+
+    /**
+     * @brief Checks whether the result is available.
+     */
+    inline auto is_ready() const noexcept -> bool { return _state && _state->is_ready(); }
+
+    /**
+     * @brief Waits until the result is available without consuming it.
+     * @throws BadHandlingException If the future is not valid.
+     */
+    auto wait() const -> void
+    {
+        if(!_state) { throw BadHandlingException("invalid future"); }
+        _state->wait();
+    }
+
+    /**
+     * @brief Waits for the result and returns it.
+     * @return The value set by the producer.
+     * @throws The exception set by the producer, or BadHandlingException if the
+     *         future is not valid.
+     */
+    auto get() -> T
+    {
+        if(!_state) { throw BadHandlingException("invalid future"); }
+        auto state = std::move(_state);
+        return state->take();
+    }
+
+    /**
+     * @brief Attaches a continuation that runs on the executor of this future.
+     * 
+     * @param func Invoked as @c func(value), or @c func() for Future<void>, once the
+     *             result is available. If the result is an exception, @p func is not
+     *             called and the exception is forwarded to the returned future.
+     * @return A future of the result of @p func.
+     * @throws BadHandlingException If the future is not valid.
+     */
+    template <typename Function>
+    auto then(Function&& func) -> Future<typename detail::ContinuationResult<std::decay_t<Function>, T>::type>
+    {
+        if(!_state) { throw BadHandlingException("invalid future"); }
+        return then(_state->get_executor(), std::forward<Function>(func));
+    }
+
+    /**
+     * @brief Attaches a continuation that runs on @p executor.
+     * @see then(Function&&)
+     */
+    template <typename Function>
+    auto then(TaskExecutor& executor, Function&& func) -> Future<typename detail::ContinuationResult<std::decay_t<Function>, T>::type>
+    {
+        if(!_state) { throw BadHandlingException("invalid future"); }
+        return then(&executor, std::forward<Function>(func));
+    }
+
+private :
+    template <typename Function>
+    auto then(TaskExecutor* executor, Function&& func) -> Future<typename detail::ContinuationResult<std::decay_t<Function>, T>::type>
+    {
+        using Result = typename detail::ContinuationResult<std::decay_t<Function>, T>::type;
+
+        auto next = detail::make_state<Result>(executor);
+        auto state = std::move(_state);
+        auto* source = state.get();
+        source->set_continuation(Task([state = std::move(state), next, func = std::forward<Function>(func)]() mutable {
+            detail::fulfill(*next, [&state, &func]() -> Result {
+                if constexpr (std::is_void_v<T>)
+                {
+                    state->take();
+                    return func();
+                }
+                else { return func(state->take()); }
+            });
+        }));
+        return Future<Result>(std::move(next));
+    }
+};
+
+/**
+ * @class Promise
+ * @brief Producer side of a Future
+ * 
+ * A promise that is destroyed without a result stores a BadHandlingException
+ * ("broken promise") so that consumers and continuations are never left waiting.
+ *
+ * @tparam T The type of the result, may be void.
+ */
+template <typename T>
+class Promise final
+{
+private :
+    std::shared_ptr<detail::FutureState<T>> _state;
+    bool _retrieved = false;
+
+public :
+    /**
+     * @brief Creates a promise.
+     * @param executor Executor that runs continuations of the future, nullptr to run
+     *                 them on the thread that sets the result.
+     */
+    explicit Promise(TaskExecutor* executor = nullptr)
+        : _state(detail::make_state<T>(executor)) {}
+
+    Promise(Promise&& other) noexcept
+        : _state(std::move(other._state))
+        , _retrieved(other._retrieved) {}
+
+    Promise& operator=(Promise&& other) noexcept
+    {
+        if(this != &other)
+        {
+            abandon();
+            _state = std::move(other._state);
+            _retrieved = other._retrieved;
+        }
+        return *this;
+    }
+
+    Promise(const Promise&) = delete;
+    Promise& operator=(const Promise&) = delete;
+
+    ~Promise() noexcept { abandon(); }
+
+public :
+    /**
+     * @brief Returns the future associated with this promise.
+     * @throws BadHandlingException If the future was already retrieved.
+     */
+    auto get_future() -> Future<T>
+    {
+        if(!_state || _retrieved) { throw BadHandlingException("future already retrieved"); }
+        _retrieved = true;
+        return Future<T>(_state);
+    }
+
+    /**
+     * @brief Stores the result.
+     * @throws BadHandlingException If a result was already stored.
+     */
+    template <typename... Args>
+    auto set_value(Args&&... args) -> void
+    {
+        if(!_state) { throw BadHandlingException("invalid promise"); }
+        _state->set_value(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Stores an exception as the result.
+     * @throws BadHandlingException If a result was already stored.
+     */
+    auto set_exception(std::exception_ptr exception) -> void
+    {
+        if(!_state) { throw BadHandlingException("invalid promise"); }
+        _state->set_exception(std::move(exception));
+    }
+
+    /**
+     * @brief Invokes @p func and stores its return value or the exception it throws.
+     */
+    template <typename Function>
+    auto set_from(Function&& func) noexcept -> void
+    {
+        if(_state) { detail::fulfill(*_state, std::forward<Function>(func)); }
+    }
+
+private :
+    auto abandon() noexcept -> void
+    {
+        if(!_state || _state->is_ready()) { return; }
+        try { _state->set_exception(std::make_exception_ptr(BadHandlingException("broken promise"))); }
+        catch(...) {}
+    }
+};
+
+/**
+ * @brief Result of when_any().
+ */
+template <typename Sequence>
+struct WhenAnyResult
+{
+    size_t _index;
+    Sequence _futures;
+};
+
+/**
+ * @brief Runs @p func on @p executor.
+ * @return A Future of the result of @p func.
+ */
+template <typename Function>
+auto spawn(TaskExecutor& executor, Function&& func) -> Future<std::invoke_result_t<std::decay_t<Function>>>
+{
+    using Result = std::invoke_result_t<std::decay_t<Function>>;
+
+    Promise<Result> promise(&executor);
+    auto future = promise.get_future();
+    executor.post(Task([promise = std::move(promise), func = std::forward<Function>(func)]() mutable {
+        promise.set_from(func);
+    }));
+    return future;
+}
+
+/**
+ * @brief Creates a future that is ready as soon as all @p futures are ready.
+ * 
+ * No thread waits: the last input that completes fulfills the result. Exceptions
+ * stay inside the individual futures.
+ *
+ * @param futures The futures to wait for, consumed.
+ * @return A future of the input futures, all of them ready.
+ */
+template <typename T>
+auto when_all(std::vector<Future<T>> futures) -> Future<std::vector<Future<T>>>
+{
+    struct Context
+    {
+        std::vector<Future<T>> _futures;
+        std::atomic<size_t> _remaining;
+        Promise<std::vector<Future<T>>> _promise;
+
+        Context(std::vector<Future<T>>&& futures, TaskExecutor* executor)
+            : _futures(std::move(futures))
+            , _remaining(_futures.size())
+            , _promise(executor) {}
+    };
+
+    TaskExecutor* executor = futures.empty() ? nullptr : detail::FutureAccess::state(futures.front())->get_executor();
+    auto context = std::make_shared<Context>(std::move(futures), executor);
+    auto result = context->_promise.get_future();
+    if(context->_futures.empty())
+    {
+        context->_promise.set_value();
+        return result;
+    }
+
+    // The last continuation may run inline and hand the futures over to the result,
+    // so iterate over a copy of the states
+    std::vector<std::shared_ptr<detail::FutureState<T>>> states;
+    states.reserve(context->_futures.size());
+    for(auto& future : context->_futures) { states.push_back(detail::FutureAccess::state(future)); }
+
+    for(auto& state : states)
+    {
+        state->set_continuation(Task([context]() {
+            if(context->_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                context->_promise.set_value(std::move(context->_futures));
+            }
+        }));
+    }
+    return result;
+}
+
+/**
+ * @brief Creates a future that is ready as soon as all @p futures are ready.
+ * @see when_all(std::vector<Future<T>>)
+ */
+template <typename... Ts>
+auto when_all(Future<Ts>... futures) -> Future<std::tuple<Future<Ts>...>>
+{
+    static_assert(sizeof...(Ts) > 0, "when_all needs at least one future");
+
+    struct Context
+    {
+        std::tuple<Future<Ts>...> _futures;
+        std::atomic<size_t> _remaining{sizeof...(Ts)};
+        Promise<std::tuple<Future<Ts>...>> _promise;
+
+        Context(Future<Ts>&&... futures, TaskExecutor* executor)
+            : _futures(std::move(futures)...)
+            , _promise(executor) {}
+    };
+
+    TaskExecutor* executor = nullptr;
+    ((executor = executor ? executor : detail::FutureAccess::state(futures)->get_executor()), ...);
+    auto states = std::make_tuple(detail::FutureAccess::state(futures)...);
+    auto context = std::make_shared<Context>(std::move(futures)..., executor);
+    auto result = context->_promise.get_future();
+
+    std::apply([&context](auto&... state) {
+        (state->set_continuation(Task([context]() {
+            if(context->_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                context->_promise.set_value(std::move(context->_futures));
+            }
+        })), ...);
+    }, states);
+    return result;
+}
+
+/**
+ * @brief Creates a future that is ready as soon as one of @p futures is ready.
+ * 
+ * @param futures The futures to wait for, consumed.
+ * @return A future of the index of the first ready future together with all input
+ *         futures. If @p futures is empty the result is ready immediately.
+ */
+template <typename T>
+auto when_any(std::vector<Future<T>> futures) -> Future<WhenAnyResult<std::vector<Future<T>>>>
+{
+    using Result = WhenAnyResult<std::vector<Future<T>>>;
+
+    struct Context
+    {
+        std::vector<Future<T>> _futures;
+        std::atomic<bool> _done{false};
+        Promise<Result> _promise;
+
+        Context(std::vector<Future<T>>&& futures, TaskExecutor* executor)
+            : _futures(std::move(futures))
+            , _promise(executor) {}
+    };
+
+    TaskExecutor* executor = futures.empty() ? nullptr : detail::FutureAccess::state(futures.front())->get_executor();
+    auto context = std::make_shared<Context>(std::move(futures), executor);
+    auto result = context->_promise.get_future();
+    if(context->_futures.empty())
+    {
+        context->_promise.set_value(Result{0, {}});
+        return result;
+    }
+
+    // The first continuation hands the futures over to the result, so iterate over a copy of the states
+    std::vector<std::shared_ptr<detail::FutureState<T>>> states;
+    states.reserve(context->_futures.size());
+    for(auto& future : context->_futures) { states.push_back(detail::FutureAccess::state(future)); }
+
+    for(size_t i = 0; i < states.size(); ++i)
+    {
+        states[i]->set_continuation(Task([context, i]() {
+            if(!context->_done.exchange(true, std::memory_order_acq_rel))
+            {
+                context->_promise.set_value(Result{i, std::move(context->_futures)});
+            }
+        }));
+    }
+    return result;
+}
+} // namespace common::threading
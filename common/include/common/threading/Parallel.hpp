@@ -0,0 +1,300 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/threading/TaskExecutor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace common::threading::parallel
+{
+/**
+ * @class TaskGroup
+ * @brief A set of tasks posted to a TaskExecutor that can be joined together
+ * 
+ * wait() does not sleep on a future: while tasks of the group are outstanding the
+ * calling thread executes pending tasks of the executor via TaskExecutor::try_run_one().
+ * Groups can therefore be nested, i.e. a task of a group may itself run and wait on
+ * another group without starving the pool. The first exception thrown by a task
+ * is rethrown by wait().
+ */
+class TaskGroup final : public NonCopyable
+{
+private :
+    TaskExecutor& _executor;
+    std::atomic<size_t> _pending{0};
+    std::exception_ptr _exception;
+    std::mutex _exceptionLock;
+
+public :
+    explicit TaskGroup(TaskExecutor& executor) noexcept
+        : _executor(executor) {}
+
+    ~TaskGroup() noexcept
+    {
+        try { wait(); }
+        catch(...) {}
+    }
+
+public :
+    /**
+     * @brief Posts a task to the executor as a member of this group
+     * @param task Any callable invocable as @c task()
+     */
+    template <typename Function>
+    auto run(Function&& task) noexcept -> void
+    {
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        _executor.post([this, func = std::forward<Function>(task)]() mutable {
+            try { func(); }
+            catch(...) { capture(std::current_exception()); }
+            _pending.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    /**
+     * @brief Waits until all tasks of the group are done, helping the executor meanwhile
+     * @throws The first exception thrown by a task of the group
+     */
+    auto wait() -> void
+    {
+        while(_pending.load(std::memory_order_acquire) > 0)
+        {
+            if(!_executor.try_run_one()) { std::this_thread::yield(); }
+        }
+
+        if(_exception)
+        {
+            auto exception = std::move(_exception);
+            _exception = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+private :
+    auto capture(std::exception_ptr exception) noexcept -> void
+    {
+        std::lock_guard<std::mutex> lock(_exceptionLock);
+        if(!_exception) { _exception = std::move(exception); }
+    }
+};
+
+namespace detail
+{
+/// @brief Chunks per worker thread when no grain size is given.
+constexpr size_t CHUNKS_PER_THREAD = 8;
+
+/**
+ * @brief Picks the grain size for @p count elements.
+ *
+ * A requested grain of 0 means automatic: the range is cut into about
+ * CHUNKS_PER_THREAD chunks per worker, but never below @p minimum elements, so
+ * small ranges are not split into tasks that cost more than they compute.
+ */
+inline auto grain_size(const TaskExecutor& executor, size_t count, size_t grain, size_t minimum = 1) noexcept -> size_t
+{
+    if(grain > 0) { return grain; }
+    const size_t chunks = static_cast<size_t>(executor.get_thread_count()) * CHUNKS_PER_THREAD;
+    return std::max<size_t>({count / chunks, minimum, 1});
+}
+
+/**
+ * @brief Calls @c body(first, last) on chunks of at most @p grain indices.
+ *
+ * The range is halved recursively and the upper halves are posted to the group, so
+ * an idle worker always steals the largest piece of work that is left.
+ */
+template <typename Index, typename Body>
+auto split(TaskGroup& group, Index first, Index last, size_t grain, const Body& body) -> void
+{
+    while(static_cast<size_t>(last - first) > grain)
+    {
+        const Index middle = first + (last - first) / 2;
+        group.run([&group, middle, last, grain, &body]() { split(group, middle, last, grain, body); });
+        last = middle;
+    }
+    body(first, last);
+}
+
+template <typename Iterator, typename Compare>
+auto merge_sort(TaskExecutor& executor, Iterator first, Iterator last, size_t grain, Compare& comp) -> void
+{
+    const auto count = static_cast<size_t>(last - first);
+    if(count <= grain)
+    {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    const Iterator middle = first + count / 2;
+    {
+        TaskGroup group(executor);
+        group.run([&executor, middle, last, grain, &comp]() { merge_sort(executor, middle, last, grain, comp); });
+        merge_sort(executor, first, middle, grain, comp);
+        group.wait();
+    }
+    std::inplace_merge(first, middle, last, comp);
+}
+} // namespace detail
+
+/**
+ * @brief Calls @c func(i) for every index in [first, last) on the executor
+ * @param executor The executor to run on
+ * @param first First index
+ * @param last Index past the last one
+ * @param func Callable invoked as @c func(i), concurrently from several threads
+ * @param grain Maximum number of indices per task, 0 for automatic
+ * @throws The first exception thrown by @p func
+ */
+template <typename Index, typename Function>
+auto parallel_for(TaskExecutor& executor, Index first, Index last, Function&& func, size_t grain = 0) -> void
+{
+    if(!(first < last)) { return; }
+
+    const auto count = static_cast<size_t>(last - first);
+    auto body = [&func](Index begin, Index end) {
+        for(Index i = begin; i < end; ++i) { func(i); }
+    };
+
+    TaskGroup group(executor);
+    detail::split(group, first, last, detail::grain_size(executor, count, grain), body);
+    group.wait();
+}
+
+/**
+ * @brief Stores @c op(x) for every element x of [first, last) to the range beginning at @p out
+ * @param executor The executor to run on
+ * @param first Random access iterator to the first input element
+ * @param last Random access iterator past the last input element
+ * @param out Random access iterator to the first output element
+ * @param op Callable invoked as @c op(x), concurrently from several threads
+ * @param grain Maximum number of elements per task, 0 for automatic
+ * @return Iterator past the last output element
+ */
+template <typename InputIterator, typename OutputIterator, typename Function>
+auto parallel_transform(TaskExecutor& executor, InputIterator first, InputIterator last,
+                        OutputIterator out, Function&& op, size_t grain = 0) -> OutputIterator
+{
+    const auto count = std::distance(first, last);
+    parallel_for(executor, decltype(count){0}, count, [first, out, &op](decltype(count) i) {
+        out[i] = op(first[i]);
+    }, grain);
+    return out + count;
+}
+
+/**
+ * @brief Reduces [first, last) with @p op, starting from @p init
+ * @param executor The executor to run on
+ * @param first Random access iterator to the first element
+ * @param last Random access iterator past the last element
+ * @param init Initial value, combined with the result of the first chunk
+ * @param op Associative binary operation. Chunks are combined in order, so it
+ *           does not need to be commutative.
+ * @param grain Maximum number of elements per chunk, 0 for automatic
+ * @return The reduced value
+ */
+template <typename Iterator, typename T, typename BinaryOperation = std::plus<>>
+auto parallel_reduce(TaskExecutor& executor, Iterator first, Iterator last, T init,
+                     BinaryOperation op = BinaryOperation(), size_t grain = 0) -> T
+{
+    const auto count = static_cast<size_t>(std::distance(first, last));
+    if(count == 0) { return init; }
+
+    const size_t chunkSize = detail::grain_size(executor, count, grain);
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    std::vector<std::optional<T>> partials(chunkCount);
+
+    parallel_for(executor, size_t{0}, chunkCount, [first, count, chunkSize, &partials, &op](size_t chunk) {
+        const size_t begin = chunk * chunkSize;
+        const size_t end = std::min(begin + chunkSize, count);
+        T value = first[begin];
+        for(size_t i = begin + 1; i < end; ++i) { value = op(std::move(value), first[i]); }
+        partials[chunk].emplace(std::move(value));
+    }, 1);
+
+    for(auto& partial : partials) { init = op(std::move(init), std::move(*partial)); }
+    return init;
+}
+
+/**
+ * @brief Runs all callables concurrently and returns when every one of them is done
+ * @param executor The executor to run on
+ * @param funcs Callables invoked as @c func(). The last one runs on the calling thread.
+ * @throws The first exception thrown by one of @p funcs
+ */
+template <typename... Functions>
+auto parallel_invoke(TaskExecutor& executor, Functions&&... funcs) -> void
+{
+    static_assert(sizeof...(Functions) > 0, "parallel_invoke needs at least one callable");
+
+    TaskGroup group(executor);
+    size_t index = 0;
+    std::exception_ptr exception;
+    auto dispatch = [&group, &index, &exception](auto& func) {
+        if(++index < sizeof...(Functions))
+        {
+            group.run([&func]() { func(); });
+            return;
+        }
+        try { func(); }
+        catch(...) { exception = std::current_exception(); }
+    };
+    (dispatch(funcs), ...);
+
+    group.wait();
+    if(exception) { std::rethrow_exception(exception); }
+}
+
+/**
+ * @brief Sorts [first, last) with a parallel merge sort
+ * @param executor The executor to run on
+ * @param first Random access iterator to the first element
+ * @param last Random access iterator past the last element
+ * @param comp Strict weak ordering, defaults to @c operator<
+ * @param grain Chunk size below which a range is sorted sequentially, 0 for automatic
+ * 
+ * Both halves of a range are sorted concurrently and merged in place. The sort is
+ * not stable.
+ */
+template <typename Iterator, typename Compare = std::less<>>
+auto parallel_sort(TaskExecutor& executor, Iterator first, Iterator last,
+                   Compare comp = Compare(), size_t grain = 0) -> void
+{
+    constexpr size_t minimumGrain = 1024;
+    const auto count = static_cast<size_t>(std::distance(first, last));
+    if(count < 2) { return; }
+    detail::merge_sort(executor, first, last, detail::grain_size(executor, count, grain, minimumGrain), comp);
+}
+} // namespace common::threading::parallel
@@ -26,11 +26,22 @@ SOFTWARE.
 
 #include "common/CommonHeader.hpp"
 #include "common/threading/Thread.hpp"
+#include "common/threading/WaitEvent.hpp"
+#include "common/utils/Histogram.hpp"
 #include "common/Exception.hpp"
 #include "common/NonCopyable.hpp"
+#include "common/container/CircularDeque.hpp"
+#include "common/container/Span.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <variant>
 
 namespace common::threading
 {
@@ -40,10 +51,51 @@ namespace common::threading
  * This class represents a task that can be executed in a separate thread.
  * It provides a way to create and manage threads, allowing for concurrent execution of tasks.
  *
+ * How often __work() is called is set by a RunPolicy. By default it is called back to
+ * back; a policy can instead pace the calls at a fixed rate, call it only when wake()
+ * is signaled, or back off while __work() reports with report_idle() that it found
+ * nothing to do. All waits end as soon as stop() is called.
+ *
  * @note A derived class must implement the pure virtual function __work() to execute a task.
  */
 class Runnable : public NonCopyable
 {
+public :
+    /**
+     * @brief How the thread paces its calls to __work()
+     */
+    struct RunPolicy
+    {
+        struct Mode
+        {
+            enum type : uint8_t
+            {
+                FREE_RUNNING,   ///< Call __work() back to back (default)
+                FIXED_RATE,     ///< Start a call every _period, measured from run() so that lateness does not accumulate
+                EVENT_DRIVEN,   ///< Call __work() each time wake() is signaled, and every _period if it is not zero
+                BACKOFF,        ///< Back to back, but sleep between _minBackoff and _maxBackoff after idle iterations
+            };
+        };
+
+        Mode::type _mode = Mode::FREE_RUNNING;
+        std::chrono::nanoseconds _period{0};
+        std::chrono::nanoseconds _minBackoff{std::chrono::microseconds(10)};   ///< First sleep after an idle iteration
+        std::chrono::nanoseconds _maxBackoff{std::chrono::milliseconds(10)};   ///< The sleep doubles up to this value
+    };
+
+    /**
+     * @brief Iteration counters and timings, see get_run_statistics()
+     */
+    struct RunStatistics
+    {
+        uint64_t _iterations = 0;               ///< Calls to __work()
+        uint64_t _idleIterations = 0;           ///< Calls that reported report_idle()
+        uint64_t _overruns = 0;                 ///< FIXED_RATE periods skipped because a call ran late
+        std::chrono::nanoseconds _busyTime{0};  ///< Total time spent inside __work()
+        utils::Histogram _workTime;             ///< Duration of each call in nanoseconds
+        utils::Histogram _interval;             ///< Time between the starts of consecutive calls in nanoseconds
+    };
+
 private :
     std::shared_ptr<Thread> _t;
     std::atomic<bool> _running{false};
@@ -55,9 +107,21 @@ private :
 #endif
     std::string _name;
 
+    RunPolicy _policy;
+    WaitEvent _event;
+    bool _idle = false;
+
+    std::atomic<bool> _statistics{false};
+    std::atomic<uint64_t> _iterations{0};
+    std::atomic<uint64_t> _idleIterations{0};
+    std::atomic<uint64_t> _overruns{0};
+    std::atomic<int64_t> _busyTime{0};
+    utils::AtomicHistogram _workTime;
+    utils::AtomicHistogram _interval;
+
 public :
     /**
-     * @brief Start a new thread and call __work() in the thread continuously.
+     * @brief Start a new thread and call __work() in the thread according to the run policy.
      * 
      * This function can be called only once.
      *
@@ -72,8 +136,8 @@ public :
         _t = Thread::create();
         _t->set_priority(_priority);
         _t->set_name(_name);
-        return _t->start([this](){            
-            while(_running.load()) { __work(); }
+        return _t->start([this, policy = _policy](){
+            loop(policy);
         });
     }
 
@@ -87,7 +151,54 @@ public :
      * Once stop() is called, status() will return false.
      * If the thread has already been stopped or was never started, this function does nothing.
      */
-    inline auto stop() noexcept -> void { _running.store(false); }
+    inline auto stop() noexcept -> void
+    {
+        _running.store(false);
+        _event.notify();
+    }
+
+    /**
+     * @brief Signals the thread. Triggers a call to __work() under RunPolicy::Mode::EVENT_DRIVEN and
+     * cuts a RunPolicy::Mode::BACKOFF sleep short.
+     */
+    inline auto wake() noexcept -> void { _event.notify(); }
+
+    /**
+     * @brief Sets the run policy. Takes effect the next time run() is called.
+     */
+    inline auto set_run_policy(const RunPolicy& policy) noexcept -> void { _policy = policy; }
+
+    inline auto get_run_policy() const noexcept -> RunPolicy { return _policy; }
+
+    /**
+     * @brief Enables or disables recording of the run statistics (disabled by default).
+     */
+    inline auto set_statistics_enabled(bool enabled) noexcept -> void { _statistics.store(enabled); }
+
+    /**
+     * @brief Snapshot of the run statistics recorded so far.
+     */
+    auto get_run_statistics() const noexcept -> RunStatistics
+    {
+        RunStatistics statistics;
+        statistics._iterations = _iterations.load(std::memory_order_relaxed);
+        statistics._idleIterations = _idleIterations.load(std::memory_order_relaxed);
+        statistics._overruns = _overruns.load(std::memory_order_relaxed);
+        statistics._busyTime = std::chrono::nanoseconds(_busyTime.load(std::memory_order_relaxed));
+        _workTime.snapshot(statistics._workTime);
+        _interval.snapshot(statistics._interval);
+        return statistics;
+    }
+
+    auto reset_run_statistics() noexcept -> void
+    {
+        _iterations.store(0, std::memory_order_relaxed);
+        _idleIterations.store(0, std::memory_order_relaxed);
+        _overruns.store(0, std::memory_order_relaxed);
+        _busyTime.store(0, std::memory_order_relaxed);
+        _workTime.reset();
+        _interval.reset();
+    }
 
     /**
      * @brief Check if run() is called and the thread is running.
@@ -152,6 +263,88 @@ protected :
      * If stop() is called, this function will return immediately.
      */
     virtual auto __work() -> void = 0;
+
+    /**
+     * @brief Called from __work() to report that the current call found nothing to do.
+     *
+     * Drives the sleep of RunPolicy::Mode::BACKOFF and is counted in RunStatistics::_idleIterations.
+     */
+    inline auto report_idle() noexcept -> void { _idle = true; }
+
+private :
+    auto loop(const RunPolicy& policy) -> void
+    {
+        using Clock = std::chrono::steady_clock;
+        using Mode = RunPolicy::Mode;
+
+        // Waiting for an event without a period still wakes up now and then to look at _running
+        constexpr std::chrono::nanoseconds POLL{std::chrono::milliseconds(100)};
+
+        auto next = Clock::now();
+        auto previous = next;
+        auto backoff = policy._minBackoff;
+        bool first = true;
+
+        while(_running.load())
+        {
+            if(policy._mode == Mode::EVENT_DRIVEN)
+            {
+                const auto timeout = policy._period.count() > 0 ? policy._period : POLL;
+                if(!_event.wait_for(timeout) && policy._period.count() == 0) { continue; }
+                if(!_running.load()) { break; }
+            }
+
+            const bool record = _statistics.load(std::memory_order_relaxed);
+            const bool timed = record || policy._mode == Mode::FIXED_RATE;
+            const auto start = timed ? Clock::now() : Clock::time_point();
+
+            _idle = false;
+            __work();
+            const bool idle = _idle;
+
+            const auto end = timed ? Clock::now() : Clock::time_point();
+            if(record)
+            {
+                const auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+                _iterations.fetch_add(1, std::memory_order_relaxed);
+                if(idle) { _idleIterations.fetch_add(1, std::memory_order_relaxed); }
+                _busyTime.fetch_add(busy, std::memory_order_relaxed);
+                _workTime.record(static_cast<uint64_t>(busy));
+                if(!first)
+                {
+                    _interval.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start - previous).count()));
+                }
+                previous = start;
+                first = false;
+            }
+
+            if(policy._mode == Mode::FIXED_RATE && policy._period.count() > 0)
+            {
+                next += policy._period;
+                if(end >= next)
+                {
+                    // Skip the periods that are already over instead of running a burst to catch up
+                    const auto missed = (end - next) / policy._period + 1;
+                    next += policy._period * missed;
+                    if(record) { _overruns.fetch_add(static_cast<uint64_t>(missed), std::memory_order_relaxed); }
+                }
+                for(auto now = Clock::now(); now < next && _running.load(); now = Clock::now())
+                {
+                    _event.wait_for(next - now);
+                }
+            }
+            else if(policy._mode == Mode::BACKOFF)
+            {
+                if(!idle)
+                {
+                    backoff = policy._minBackoff;
+                    continue;
+                }
+                _event.wait_for(backoff);
+                backoff = std::min(backoff * 2, policy._maxBackoff);
+            }
+        }
+    }
 };
 
 namespace base
@@ -170,6 +363,17 @@ class WorkInterface<DataType, void>
 public :
     virtual ~WorkInterface() = default;
     virtual auto __work(DataType&& data) -> void = 0;
+
+    /**
+     * @brief Called instead of __work() in batch mode with every message drained from the mailbox.
+     *
+     * The default implementation hands the messages to __work() one by one.
+     * Elements may be moved from.
+     */
+    virtual auto __work_batch(Span<DataType> batch) -> void
+    {
+        for(auto& data : batch) { __work(std::move(data)); }
+    }
 };
 
 template <typename ReturnType>
@@ -198,7 +402,13 @@ public :
  * The task can be stopped by calling stop(), and the thread started by run() will be stopped.
  * If the task is stopped, status() will return false.
  *
- * @tparam DataType The type of data to be passed to __work(). Use void for no input data.
+ * Messages are kept in a mailbox that the thread empties in one step, so a burst of
+ * notifications costs one lock acquisition and at most one wake-up on the receiving side.
+ * post() enqueues a message without creating a promise. The mailbox can be bounded with
+ * set_capacity(), and when DataType is not void and ReturnType is void, set_batch_mode()
+ * hands every drained message to __work_batch() at once.
+ *
+ * @tparam DataType The type of data to be passed to __work(). Use void for no input data. May be move-only.
  * @tparam ReturnType The return type of __work(). Use void for no return value.
  *
  * @note A derived class must implement the pure virtual function __work() from base::WorkInterface to execute a task.
@@ -207,19 +417,46 @@ template <typename DataType, typename ReturnType>
 class ActiveRunnable : public base::WorkInterface<DataType, ReturnType>,
                        public NonCopyable
 {
+public :
+    /**
+     * @brief What notify() and post() do when the mailbox is at its capacity.
+     */
+    struct Overflow
+    {
+        enum type : uint8_t
+        {
+            BLOCK,          ///< Wait until the thread takes messages out of the mailbox.
+            DROP_OLDEST,    ///< Discard the oldest queued message. Its future reports a broken promise.
+            REJECT          ///< Refuse the new message.
+        };
+    };
+
 private :
+    using Payload = std::conditional_t<std::is_void_v<DataType>, std::monostate, DataType>;
+
+    struct Message
+    {
+        std::optional<Payload> _data;
+        std::optional<std::promise<ReturnType>> _promise;
+    };
+
     std::shared_ptr<Thread> _t;
     std::atomic<bool> _running{false};
 
     std::mutex _notifyLock;
     std::condition_variable _cv;
+    std::condition_variable _space;
 
-    using PromiseType = std::shared_ptr<std::promise<ReturnType>>;
-    using TaskType = std::conditional_t<std::is_void_v<DataType>,
-                                        PromiseType,
-                                        std::pair<DataType, PromiseType>>;
+    CircularDeque<Message> _mailbox;
+    CircularDeque<Message> _draining;
+    std::vector<Payload> _batchData;
+    bool _waiting = false;
+    bool _closed = false;
+    size_t _blocked = 0;
 
-    std::vector<TaskType> _tasks;
+    size_t _capacity = 0;
+    typename Overflow::type _overflow = Overflow::BLOCK;
+    std::atomic<bool> _batch{false};
 
 #if defined(WIN32)
     Thread::Priority _priority = Thread::Policies::DEFAULT;
@@ -240,46 +477,35 @@ public :
     auto run() -> std::future<void>
     {
         if(_running.load()) throw AlreadyRunningException();
-        _running.store(true);
+        {
+            std::unique_lock<std::mutex> lock(_notifyLock);
+            _closed = false;
+            _running.store(true);
+        }
 
         _t = Thread::create();
         return _t->start([this](){
             _t->set_priority(_priority);
             _t->set_name(_name);
 
-            while(_running.load())
+            while(true)
             {
-                std::unique_lock<std::mutex> lock(_notifyLock);
-                if(_tasks.empty()) _cv.wait(lock);
-                if(!_running.load()) break;
-
-                auto task = _tasks[0];
-                _tasks.erase(_tasks.begin());
-                lock.unlock();
-
-                if constexpr (std::is_void_v<DataType> && std::is_void_v<ReturnType>)
                 {
-                    this->__work();
-                    task->set_value();
+                    std::unique_lock<std::mutex> lock(_notifyLock);
+                    _waiting = true;
+                    _cv.wait(lock, [this](){ return !_running.load() || !_mailbox.empty(); });
+                    _waiting = false;
+                    if(!_running.load()) break;
+
+                    std::swap(_mailbox, _draining);
+                    if(_blocked != 0) { _space.notify_all(); }
                 }
-                else if constexpr (std::is_void_v<DataType>)
-                {
-                    auto promise = task;
-                    promise->set_value(this->__work());
-                }
-                else if constexpr (std::is_void_v<ReturnType>)
-                {
-                    auto data = std::get<0>(task);
-                    auto promise = std::get<1>(task);
-                    this->__work(std::move(data));
-                    promise->set_value();
-                }
-                else
+
+                if constexpr (!std::is_void_v<DataType> && std::is_void_v<ReturnType>)
                 {
-                    auto data = std::get<0>(task);
-                    auto promise = std::get<1>(task);
-                    promise->set_value(this->__work(std::move(data)));
+                    if(_batch.load(std::memory_order_relaxed)) { process_batch(); continue; }
                 }
+                process();
             }
         });
     }
@@ -288,62 +514,120 @@ public :
      * @brief Notify the thread to execute work() with the data.
      *
      * @param data Data to be passed to work()
+     * @return Future of the result. Holds a RuntimeException if the mailbox refused the message.
      */
     template<typename T = DataType>
-    auto notify(const T& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
+    auto notify(const Payload& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
     {
-        PromiseType promise = std::make_shared<std::promise<ReturnType>>();
-        auto future = promise->get_future();
-
-        std::unique_lock<std::mutex> lock(_notifyLock);
-        _tasks.push_back({data, std::move(promise)});
-        _cv.notify_one();
-
-        return future;
+        return submit(Payload(data));
     }
 
     /**
      * @brief Notify the thread to execute work() with the data.
      *
      * @param data Data to be passed to work()
+     * @return Future of the result. Holds a RuntimeException if the mailbox refused the message.
      */
     template<typename T = DataType>
-    auto notify(const T&& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
+    auto notify(Payload&& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
     {
-        PromiseType promise = std::make_shared<std::promise<ReturnType>>();
-        auto future = promise->get_future();
-
-        std::unique_lock<std::mutex> lock(_notifyLock);
-        _tasks.push_back({std::move(data), std::move(promise)});
-        _cv.notify_one();
+        return submit(std::move(data));
+    }
 
-        return future;
+    /**
+     * @brief Notify the thread to execute work().
+     *
+     * @return Future of the result. Holds a RuntimeException if the mailbox refused the message.
+     */
+    template<typename T = DataType>
+    auto notify() noexcept -> std::enable_if_t<std::is_void_v<T>, std::future<ReturnType>>
+    {
+        return submit(Payload());
     }
 
     /**
-     * @brief Notify the thread to execute work() with the data.
+     * @brief Fire-and-forget version of notify() that does not create a promise.
      *
      * @param data Data to be passed to work()
+     * @return true if the message was queued, false if the mailbox refused it.
      */
     template<typename T = DataType>
-    auto notify() noexcept -> std::enable_if_t<std::is_void_v<T>, std::future<ReturnType>>
+    auto post(Payload data) noexcept -> std::enable_if_t<!std::is_void_v<T>, bool>
     {
-        PromiseType promise = std::make_shared<std::promise<ReturnType>>();
-        auto future = promise->get_future();
+        Message message;
+        message._data.emplace(std::move(data));
+        return enqueue(message);
+    }
 
+    /**
+     * @brief Fire-and-forget version of notify() that does not create a promise.
+     *
+     * @return true if the message was queued, false if the mailbox refused it.
+     */
+    template<typename T = DataType>
+    auto post() noexcept -> std::enable_if_t<std::is_void_v<T>, bool>
+    {
+        Message message;
+        return enqueue(message);
+    }
+
+    /**
+     * @brief Bounds the number of messages waiting in the mailbox.
+     *
+     * Messages the thread has already taken out of the mailbox are not counted.
+     *
+     * @param capacity Maximum number of queued messages, 0 for unbounded (default).
+     * @param overflow What to do with a message that arrives while the mailbox is full.
+     */
+    auto set_capacity(size_t capacity, typename Overflow::type overflow = Overflow::BLOCK) -> void
+    {
         std::unique_lock<std::mutex> lock(_notifyLock);
-        _tasks.push_back(std::move(promise));
-        _cv.notify_one();
+        _capacity = capacity;
+        _overflow = overflow;
+        _space.notify_all();
+    }
 
-        return future;
+    auto get_capacity() -> size_t
+    {
+        std::unique_lock<std::mutex> lock(_notifyLock);
+        return _capacity;
+    }
+
+    auto get_overflow() -> typename Overflow::type
+    {
+        std::unique_lock<std::mutex> lock(_notifyLock);
+        return _overflow;
     }
 
+    /**
+     * @brief Number of messages waiting in the mailbox.
+     */
+    auto pending() -> size_t
+    {
+        std::unique_lock<std::mutex> lock(_notifyLock);
+        return _mailbox.size();
+    }
+
+    /**
+     * @brief Hands every drained message to __work_batch() in one call instead of calling __work() per message.
+     *
+     * Promises of a batch are fulfilled after __work_batch() returns.
+     */
+    template<typename T = DataType>
+    auto set_batch_mode(bool enabled) noexcept -> std::enable_if_t<!std::is_void_v<T> && std::is_void_v<ReturnType>>
+    {
+        _batch.store(enabled);
+    }
+
+    inline auto get_batch_mode() const noexcept -> bool { return _batch.load(); }
+
     /**
      * @brief Request to stop the thread started by run().
      * 
      * This function sets a flag to request the running thread to stop. 
      * The thread will not stop immediately but will stop after the current 
      * iteration of __work() completes or when it is safe to stop. 
+     * Producers blocked on a full mailbox are released and their messages refused.
      * 
      * Once stop() is called, status() will return false.
      * If the thread has already been stopped or was never started, this function does nothing.
@@ -352,7 +636,9 @@ public :
     {
         std::unique_lock<std::mutex> lock(_notifyLock);
         _running.store(false);
+        _closed = true;
         _cv.notify_one();
+        _space.notify_all();
     }
 
     /**
@@ -407,5 +693,85 @@ public :
     {
         return _name;
     }
+
+private :
+    auto submit(Payload&& data) noexcept -> std::future<ReturnType>
+    {
+        Message message;
+        if constexpr (!std::is_void_v<DataType>) { message._data.emplace(std::move(data)); }
+        auto future = message._promise.emplace().get_future();
+        if(!enqueue(message))
+        {
+            message._promise->set_exception(std::make_exception_ptr(RuntimeException("mailbox refused the message")));
+        }
+        return future;
+    }
+
+    /**
+     * @brief Moves the message into the mailbox, leaving it untouched if it is refused.
+     */
+    auto enqueue(Message& message) noexcept -> bool
+    {
+        bool wake = false;
+        {
+            std::unique_lock<std::mutex> lock(_notifyLock);
+            while(_capacity != 0 && _mailbox.size() >= _capacity)
+            {
+                if(_overflow == Overflow::REJECT || _closed) { return false; }
+                if(_overflow == Overflow::DROP_OLDEST) { _mailbox.pop_front(); continue; }
+
+                ++_blocked;
+                _space.wait(lock);
+                --_blocked;
+            }
+            _mailbox.push_back(std::move(message));
+            wake = _waiting;
+        }
+        if(wake) { _cv.notify_one(); }
+        return true;
+    }
+
+    auto process() -> void
+    {
+        while(!_draining.empty() && _running.load(std::memory_order_relaxed))
+        {
+            Message message = _draining.pop_front();
+            if constexpr (std::is_void_v<DataType> && std::is_void_v<ReturnType>)
+            {
+                this->__work();
+                if(message._promise) { message._promise->set_value(); }
+            }
+            else if constexpr (std::is_void_v<DataType>)
+            {
+                auto result = this->__work();
+                if(message._promise) { message._promise->set_value(std::move(result)); }
+            }
+            else if constexpr (std::is_void_v<ReturnType>)
+            {
+                this->__work(std::move(*message._data));
+                if(message._promise) { message._promise->set_value(); }
+            }
+            else
+            {
+                auto result = this->__work(std::move(*message._data));
+                if(message._promise) { message._promise->set_value(std::move(result)); }
+            }
+        }
+        _draining.clear();
+    }
+
+    auto process_batch() -> void
+    {
+        _batchData.clear();
+        for(size_t i = 0; i < _draining.size(); ++i) { _batchData.push_back(std::move(*_draining[i]._data)); }
+
+        this->__work_batch(Span<DataType>{_batchData.data(), _batchData.size()});
+
+        for(size_t i = 0; i < _draining.size(); ++i)
+        {
+            if(_draining[i]._promise) { _draining[i]._promise->set_value(); }
+        }
+        _draining.clear();
+    }
 };
 } // namespace common::threading
@@ -0,0 +1,384 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/Exception.hpp"
+#include "common/container/CircularDeque.hpp"
+#include "common/threading/Runnable.hpp"
+#include "common/threading/Task.hpp"
+#include "common/threading/TaskExecutor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace common::threading
+{
+/**
+ * @class Strand
+ * @brief Runs tasks one at a time and in submission order on a shared TaskExecutor
+ *
+ * A strand owns no thread. The first task posted to an idle strand schedules a drain
+ * on the executor, which runs queued tasks back to back until the strand is empty.
+ * At most one drain is scheduled at any time, so tasks of the same strand never run
+ * concurrently, while any number of strands share the executor's workers.
+ *
+ * After running a batch of tasks a busy strand goes to the back of the executor's
+ * queue so that one chatty strand cannot starve the others.
+ *
+ * An exception thrown by a posted task is discarded. Tasks submitted with load()
+ * deliver it through their future.
+ */
+class COMMON_LIB_API Strand final : public NonCopyable,
+                                    public Factory<Strand>,
+                                    public std::enable_shared_from_this<Strand>
+{
+    friend class Factory<Strand>;
+
+private :
+    std::shared_ptr<TaskExecutor> _executor;
+    TaskExecutor::Priority::type _priority;
+    size_t _batch;
+
+    std::mutex _lock;
+    CircularDeque<Task> _tasks;
+    bool _scheduled = false;
+
+private :
+    /**
+     * @brief Factory method to create a Strand instance
+     * @param executor Executor the tasks run on
+     * @param priority Lane of the executor the strand is scheduled in
+     * @param batch Number of tasks run before the strand yields the worker
+     */
+    static auto __create(std::shared_ptr<TaskExecutor> executor,
+                         TaskExecutor::Priority::type priority = TaskExecutor::Priority::NORMAL,
+                         size_t batch = 32) noexcept -> std::shared_ptr<Strand>
+    {
+        return std::shared_ptr<Strand>(new Strand(std::move(executor), priority, batch));
+    }
+
+    Strand(std::shared_ptr<TaskExecutor> executor, TaskExecutor::Priority::type priority, size_t batch) noexcept;
+
+public :
+    /**
+     * @brief Queues a task without creating a future
+     */
+    template <typename Function>
+    auto post(Function&& task) noexcept -> void
+    {
+        post(Task(std::forward<Function>(task)));
+    }
+
+    auto post(Task&& task) noexcept -> void;
+
+    /**
+     * @brief Queues a task
+     * @return A future of the result of the task
+     */
+    template <typename ReturnType, typename Function>
+    auto load(Function&& task) noexcept -> std::future<ReturnType>
+    {
+        auto [wrapped, future] = make_task<ReturnType>(std::forward<Function>(task));
+        post(std::move(wrapped));
+        return std::move(future);
+    }
+
+    /**
+     * @brief Checks whether the calling thread is currently running a task of this strand
+     */
+    auto running_in_this_thread() const noexcept -> bool;
+
+    /**
+     * @brief Number of tasks waiting to run
+     */
+    auto pending() noexcept -> size_t;
+
+    inline auto get_executor() const noexcept -> const std::shared_ptr<TaskExecutor>& { return _executor; }
+
+private :
+    auto schedule() noexcept -> void;
+    auto drain() noexcept -> void;
+};
+
+/**
+ * @brief ActiveRunnable counterpart that is driven by a Strand instead of a thread of its own.
+ *
+ * Every notification becomes a task of the runnable's strand, so __work() is never
+ * called concurrently and messages are handled in the order they were sent, yet
+ * hundreds of runnables can share the few workers of one TaskExecutor. Several
+ * runnables may also share a strand to be serialized with each other.
+ *
+ * __work() runs on an executor worker and should not block for long. An exception it
+ * throws is delivered through the future returned by notify().
+ *
+ * The runnable accepts messages from construction until stop(). It is built with create(),
+ * whose deleter stops the runnable and waits for the message being handled before the
+ * derived part is destroyed, so __work() never runs on a half destroyed object. Messages
+ * that have not started by then are dropped. The executor has to keep running until then.
+ *
+ * Derived classes inherit the constructors or take a Passkey as their first parameter
+ * and hand it to the base, which keeps them from being constructed any other way.
+ *
+ * @tparam DataType The type of data to be passed to __work(). Use void for no input data. May be move-only.
+ * @tparam ReturnType The return type of __work(). Use void for no return value.
+ */
+template <typename DataType, typename ReturnType>
+class StrandRunnable : public base::WorkInterface<DataType, ReturnType>,
+                       public NonCopyable
+{
+private :
+    using Payload = std::conditional_t<std::is_void_v<DataType>, std::monostate, DataType>;
+
+    struct Message
+    {
+        std::optional<Payload> _data;
+        std::optional<std::promise<ReturnType>> _promise;
+    };
+
+    /**
+     * @brief Strand task carrying one message, accounted for until it is destroyed
+     */
+    class Delivery
+    {
+    private :
+        StrandRunnable* _owner;
+        Message _message;
+
+    public :
+        Delivery(StrandRunnable* owner, Message&& message) noexcept
+            : _owner(owner), _message(std::move(message)) {}
+        Delivery(Delivery&& other) noexcept
+            : _owner(std::exchange(other._owner, nullptr)), _message(std::move(other._message)) {}
+        Delivery(const Delivery&) = delete;
+        ~Delivery() { if(_owner) { _owner->release(); } }
+
+        auto operator()() -> void { _owner->deliver(_message); }
+    };
+
+    std::shared_ptr<Strand> _strand;
+    std::atomic<bool> _running{true};
+
+    std::mutex _lock;
+    std::condition_variable _idle;
+    size_t _inFlight = 0;
+
+public :
+    /**
+     * @brief Proof that the runnable is being built by create()
+     */
+    class Passkey
+    {
+        friend class StrandRunnable;
+        Passkey() noexcept {}
+    };
+
+    /**
+     * @brief Creates a runnable of the derived type
+     *
+     * @tparam Derived Type to create
+     * @param args Arguments for the constructor of Derived, following the Passkey
+     * @return Runnable that is stopped and drained before the derived part is destroyed
+     */
+    template <typename Derived, typename... Args>
+    static auto create(Args&&... args) noexcept -> std::shared_ptr<Derived>
+    {
+        static_assert(std::is_base_of_v<StrandRunnable, Derived>, "Derived must be a StrandRunnable.");
+        return std::shared_ptr<Derived>(new Derived(Passkey(), std::forward<Args>(args)...), [](Derived* runnable) {
+            static_cast<StrandRunnable*>(runnable)->stop_and_wait();
+            delete runnable;
+        });
+    }
+
+    /**
+     * @brief Creates a runnable on a strand of its own
+     */
+    StrandRunnable([[maybe_unused]] Passkey key, std::shared_ptr<TaskExecutor> executor)
+        : _strand(Strand::create(std::move(executor))) {}
+
+    /**
+     * @brief Creates a runnable on the given strand
+     */
+    StrandRunnable([[maybe_unused]] Passkey key, std::shared_ptr<Strand> strand)
+        : _strand(std::move(strand)) {}
+
+    virtual ~StrandRunnable()
+    {
+        stop_and_wait();
+    }
+
+    /**
+     * @brief Notify the runnable to execute __work() with the data.
+     *
+     * @param data Data to be passed to __work()
+     * @return Future of the result. Reports a broken promise if the runnable is stopped first.
+     */
+    template<typename T = DataType>
+    auto notify(const Payload& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
+    {
+        return submit(Payload(data));
+    }
+
+    /**
+     * @brief Notify the runnable to execute __work() with the data.
+     *
+     * @param data Data to be passed to __work()
+     * @return Future of the result. Reports a broken promise if the runnable is stopped first.
+     */
+    template<typename T = DataType>
+    auto notify(Payload&& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
+    {
+        return submit(std::move(data));
+    }
+
+    /**
+     * @brief Notify the runnable to execute __work().
+     *
+     * @return Future of the result. Reports a broken promise if the runnable is stopped first.
+     */
+    template<typename T = DataType>
+    auto notify() noexcept -> std::enable_if_t<std::is_void_v<T>, std::future<ReturnType>>
+    {
+        return submit(Payload());
+    }
+
+    /**
+     * @brief Fire-and-forget version of notify() that does not create a promise.
+     *
+     * @return true if the message was queued, false if the runnable is stopped.
+     */
+    template<typename T = DataType>
+    auto post(Payload data) noexcept -> std::enable_if_t<!std::is_void_v<T>, bool>
+    {
+        Message message;
+        message._data.emplace(std::move(data));
+        return dispatch(std::move(message));
+    }
+
+    /**
+     * @brief Fire-and-forget version of notify() that does not create a promise.
+     *
+     * @return true if the message was queued, false if the runnable is stopped.
+     */
+    template<typename T = DataType>
+    auto post() noexcept -> std::enable_if_t<std::is_void_v<T>, bool>
+    {
+        Message message;
+        return dispatch(std::move(message));
+    }
+
+    /**
+     * @brief Stops accepting messages. Messages that have not been handled yet are dropped.
+     */
+    inline auto stop() noexcept -> void { _running.store(false); }
+
+    /**
+     * @brief Check if the runnable accepts messages.
+     */
+    inline auto status() const noexcept -> bool { return _running.load(); }
+
+    inline auto get_strand() const noexcept -> const std::shared_ptr<Strand>& { return _strand; }
+
+private :
+    /**
+     * @brief Stops the runnable and waits until no message handed to the strand refers to it anymore.
+     *
+     * A __work() that is running finishes, messages that have not started are dropped.
+     */
+    auto stop_and_wait() noexcept -> void
+    {
+        stop();
+        std::unique_lock<std::mutex> lock(_lock);
+        _idle.wait(lock, [this](){ return _inFlight == 0; });
+    }
+
+    auto submit(Payload&& data) noexcept -> std::future<ReturnType>
+    {
+        Message message;
+        if constexpr (!std::is_void_v<DataType>) { message._data.emplace(std::move(data)); }
+        auto future = message._promise.emplace().get_future();
+        dispatch(std::move(message));
+        return future;
+    }
+
+    auto dispatch(Message&& message) noexcept -> bool
+    {
+        if(!_running.load()) { return false; }
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            ++_inFlight;
+        }
+        _strand->post(Delivery(this, std::move(message)));
+        return true;
+    }
+
+    auto release() noexcept -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if(--_inFlight == 0) { _idle.notify_all(); }
+    }
+
+    auto deliver(Message& message) -> void
+    {
+        if(!_running.load()) { return; }
+        try
+        {
+            if constexpr (std::is_void_v<DataType> && std::is_void_v<ReturnType>)
+            {
+                this->__work();
+                if(message._promise) { message._promise->set_value(); }
+            }
+            else if constexpr (std::is_void_v<DataType>)
+            {
+                auto result = this->__work();
+                if(message._promise) { message._promise->set_value(std::move(result)); }
+            }
+            else if constexpr (std::is_void_v<ReturnType>)
+            {
+                this->__work(std::move(*message._data));
+                if(message._promise) { message._promise->set_value(); }
+            }
+            else
+            {
+                auto result = this->__work(std::move(*message._data));
+                if(message._promise) { message._promise->set_value(std::move(result)); }
+            }
+        }
+        catch(...)
+        {
+            if(message._promise) { message._promise->set_exception(std::current_exception()); }
+        }
+    }
+};
+} // namespace common::threading
@@ -0,0 +1,238 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/memory/BlockPool.hpp"
+
+#include <cstddef>
+#include <future>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace common::threading
+{
+/**
+ * @brief Move-only, type-erased @c void() callable with small buffer optimization.
+ *
+ * Callables of up to INLINE_SIZE bytes that are nothrow move constructible are stored
+ * inside the Task itself, larger ones are placed in a memory::BlockPool block. Unlike
+ * std::function, a Task can hold move-only callables (e.g. a lambda owning a std::promise)
+ * and never touches the heap for capture-light lambdas. A Task is exactly one cache line.
+ */
+class Task final
+{
+public :
+    static constexpr size_t INLINE_SIZE = 64 - sizeof(void*);
+
+private :
+    struct Operations
+    {
+        void (*_invoke)(void* storage);
+        void (*_move)(void* from, void* to) noexcept;
+        void (*_destroy)(void* storage) noexcept;
+    };
+
+    template <typename Function>
+    static constexpr bool _isInline = sizeof(Function) <= INLINE_SIZE
+                                   && alignof(Function) <= alignof(void*)
+                                   && std::is_nothrow_move_constructible_v<Function>;
+
+    template <typename Function>
+    struct InlineStorage
+    {
+        static auto get(void* storage) noexcept -> Function*
+        {
+            return std::launder(reinterpret_cast<Function*>(storage));
+        }
+
+        static auto invoke(void* storage) -> void { (*get(storage))(); }
+
+        static auto move(void* from, void* to) noexcept -> void
+        {
+            new (to) Function(std::move(*get(from)));
+            get(from)->~Function();
+        }
+
+        static auto destroy(void* storage) noexcept -> void { get(storage)->~Function(); }
+
+        static constexpr Operations _operations{&invoke, &move, &destroy};
+    };
+
+    template <typename Function>
+    struct PooledStorage
+    {
+        static auto get(void* storage) noexcept -> Function*
+        {
+            return *std::launder(reinterpret_cast<Function**>(storage));
+        }
+
+        static auto invoke(void* storage) -> void { (*get(storage))(); }
+
+        static auto move(void* from, void* to) noexcept -> void
+        {
+            new (to) Function*(get(from));
+        }
+
+        static auto destroy(void* storage) noexcept -> void
+        {
+            Function* func = get(storage);
+            func->~Function();
+            memory::BlockPool::deallocate(func, sizeof(Function));
+        }
+
+        static constexpr Operations _operations{&invoke, &move, &destroy};
+    };
+
+private :
+    const Operations* _operations = nullptr;
+    alignas(void*) unsigned char _storage[INLINE_SIZE];
+
+public :
+    Task() noexcept = default;
+    Task(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Wraps a callable.
+     *
+     * @param func Any callable invocable as @c func(). Copied or moved into the task.
+     */
+    template <typename Function,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Function>, Task> &&
+                                          !std::is_same_v<std::decay_t<Function>, std::nullptr_t>>>
+    Task(Function&& func)
+    {
+        using Type = std::decay_t<Function>;
+        if constexpr (_isInline<Type>)
+        {
+            new (_storage) Type(std::forward<Function>(func));
+            _operations = &InlineStorage<Type>::_operations;
+        }
+        else
+        {
+            static_assert(alignof(Type) <= alignof(std::max_align_t), "over-aligned callables are not supported");
+            void* block = memory::BlockPool::allocate(sizeof(Type));
+            try { new (block) Type(std::forward<Function>(func)); }
+            catch(...)
+            {
+                memory::BlockPool::deallocate(block, sizeof(Type));
+                throw;
+            }
+            new (_storage) Type*(static_cast<Type*>(block));
+            _operations = &PooledStorage<Type>::_operations;
+        }
+    }
+
+    Task(Task&& other) noexcept { take(other); }
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if(this != &other)
+        {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    Task& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() noexcept { reset(); }
+
+public :
+    /**
+     * @brief Invokes the wrapped callable.
+     * @warning Calling an empty task is undefined behavior.
+     */
+    inline auto operator()() -> void { _operations->_invoke(_storage); }
+
+    /**
+     * @brief Checks whether the task holds a callable.
+     */
+    inline explicit operator bool() const noexcept { return _operations != nullptr; }
+
+    /**
+     * @brief Destroys the wrapped callable, leaving the task empty.
+     */
+    inline auto reset() noexcept -> void
+    {
+        if(_operations)
+        {
+            _operations->_destroy(_storage);
+            _operations = nullptr;
+        }
+    }
+
+private :
+    inline auto take(Task& other) noexcept -> void
+    {
+        if(!other._operations) { return; }
+        other._operations->_move(other._storage, _storage);
+        _operations = other._operations;
+        other._operations = nullptr;
+    }
+};
+
+/**
+ * @brief Wraps @p func into a Task that delivers its result through a pooled promise.
+ *
+ * The shared state of the promise/future pair is allocated from memory::BlockPool, so
+ * together with an inline Task no heap allocation is made. An exception thrown by
+ * @p func is stored in the future.
+ *
+ * @tparam ReturnType The return type of @p func.
+ * @param func The callable to wrap.
+ * @return The task together with the future of its result.
+ */
+template <typename ReturnType, typename Function>
+auto make_task(Function&& func) -> std::tuple<Task, std::future<ReturnType>>
+{
+    std::promise<ReturnType> promise(std::allocator_arg, memory::PoolAllocator<ReturnType>());
+    std::future<ReturnType> future = promise.get_future();
+
+    Task task([promise = std::move(promise), func = std::forward<Function>(func)]() mutable {
+        try
+        {
+            if constexpr (std::is_void_v<ReturnType>)
+            {
+                func();
+                promise.set_value();
+            }
+            else { promise.set_value(func()); }
+        }
+        catch(...) { promise.set_exception(std::current_exception()); }
+    });
+    return {std::move(task), std::move(future)};
+}
+} // namespace common::threading
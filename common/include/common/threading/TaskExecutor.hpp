@@ -28,11 +28,21 @@ SOFTWARE.
 
 #include "common/NonCopyable.hpp"
 #include "common/Factory.hpp"
+#include "common/utils/Histogram.hpp"
 #include "common/utils/Misc.hpp"
 #include "common/threading/Thread.hpp"
+#include "common/threading/Task.hpp"
 #include "common/container/WorkQueue.hpp"
+#include "common/container/LockFreeWorkQueue.hpp"
+#include "common/container/CircularDeque.hpp"
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
 #include <vector>
 
 namespace common::threading
@@ -44,125 +54,658 @@ namespace common::threading
  * TaskExecutor implements a work-stealing thread pool that distributes tasks across
  * multiple worker threads. It uses a round-robin approach for task distribution and
  * employs work-stealing to balance load across threads.
+ *
+ * The queueing strategy is selected at construction time:
+ * - Mode::LOCKED : every worker owns a mutex/condvar backed WorkQueue. Stealing
+ *   takes the victim's lock (default).
+ * - Mode::LOCK_FREE : every worker owns a Chase-Lev LockFreeWorkQueue. A task loaded
+ *   from a worker thread is pushed to the bottom of that worker's own deque, idle
+ *   workers steal from the top of the other deques without locking, and a worker
+ *   parks only after a bounded spin. Tasks loaded from outside the pool go through
+ *   a shared injection queue that idle workers drain in batches. Best suited for
+ *   fork-join workloads made of many small tasks.
+ *
+ * Every queue is split into one lane per Priority. A worker always takes a
+ * Priority::REAL_TIME task before a Priority::NORMAL one and a normal task before a
+ * Priority::BACKGROUND one; in Mode::LOCK_FREE this also holds for the injection
+ * queue and for stealing. Tasks submitted with load_by() / post_by() carry a
+ * deadline and are executed earliest-deadline-first, ahead of normal tasks.
+ * Per-lane queueing delay can be recorded with set_statistics_enabled().
+ *
+ * Workers can be pinned to CPUs with a Placement. Pinned workers are grouped by
+ * NUMA node and an idle worker tries to steal from workers on its own node before
+ * it crosses to another node.
+ *
+ * A worker that runs out of work follows its IdlePolicy: it spins, then yields, then
+ * parks until a task is submitted. Spinning keeps the wake-up latency of a task that
+ * arrives shortly after the worker went idle far below the cost of a futex wake-up.
+ *
+ * The worker count is fixed, but set_elasticity() turns on a load monitor that adds
+ * helper threads, up to a maximum, while tasks pile up or wait too long and while
+ * workers are blocked inside long running tasks. Helpers steal queued tasks and
+ * retire after an idle timeout.
+ *
+ * set_telemetry_enabled() turns on per-worker counters and histograms of queueing
+ * delay and run time, read with get_telemetry().
  */
-class TaskExecutor final : public NonCopyable,
-                           public Factory<TaskExecutor>
+class COMMON_LIB_API TaskExecutor final : public NonCopyable,
+                                          public Factory<TaskExecutor>
 {
     friend class Factory<TaskExecutor>;
 
+public :
+    /**
+     * @brief Queueing strategy used by the worker threads
+     */
+    struct Mode
+    {
+        enum type : uint8_t
+        {
+            LOCKED,
+            LOCK_FREE,
+        };
+    };
+
+    /**
+     * @brief CPU placement of the worker threads
+     */
+    struct Placement
+    {
+        enum type : uint8_t
+        {
+            NONE,       ///< Workers may run on any CPU (default)
+            CORE,       ///< Each worker is pinned to one CPU, CPUs are handed out node by node
+            NUMA_NODE,  ///< Each worker is pinned to all CPUs of one NUMA node
+        };
+    };
+
+    /**
+     * @brief What a worker does when it runs out of work
+     */
+    struct IdlePolicy
+    {
+        struct Strategy
+        {
+            enum type : uint8_t
+            {
+                PARK,       ///< Park right away
+                SPIN,       ///< Spin for _spin, yield for _yield, then park (default)
+                ADAPTIVE,   ///< Like SPIN, but only as long as the next task is expected to arrive
+                BUSY_POLL,  ///< Never park: spin for _spin, then keep yielding
+            };
+        };
+
+        Strategy::type _strategy = Strategy::SPIN;
+        std::chrono::nanoseconds _spin{std::chrono::microseconds(2)};   ///< Time spent spinning with cpu_relax()
+        std::chrono::nanoseconds _yield{std::chrono::microseconds(0)};  ///< Time spent yielding after spinning
+    };
+
+    /**
+     * @brief Counters and histograms of one worker, see get_telemetry()
+     */
+    struct WorkerTelemetry
+    {
+        uint64_t _tasks = 0;                    ///< Tasks run
+        uint64_t _stealAttempts = 0;            ///< Tries to take a task from the queue of another worker
+        uint64_t _steals = 0;                   ///< Tries that returned a task
+        uint64_t _parks = 0;                    ///< Times the worker blocked waiting for work
+        std::chrono::nanoseconds _idleTime{0};  ///< Time spent between running out of work and the next task
+        size_t _queueDepth = 0;                 ///< Tasks queued for the worker when the snapshot was taken
+        utils::Histogram _waitTime;             ///< Queueing delay in nanoseconds
+        utils::Histogram _runTime;              ///< Run time in nanoseconds
+
+        /// @brief Adds the counts of another worker.
+        inline auto merge(const WorkerTelemetry& other) noexcept -> void
+        {
+            _tasks += other._tasks;
+            _stealAttempts += other._stealAttempts;
+            _steals += other._steals;
+            _parks += other._parks;
+            _idleTime += other._idleTime;
+            _queueDepth += other._queueDepth;
+            _waitTime.merge(other._waitTime);
+            _runTime.merge(other._runTime);
+        }
+    };
+
+    /**
+     * @brief Growth and shrink rules of an elastic pool, see set_elasticity()
+     */
+    struct Elasticity
+    {
+        uint32_t _maxThreads = 0;   ///< Upper bound of workers plus helpers, growth is off up to get_thread_count()
+        size_t _queueDepth = 32;    ///< Pending tasks per runnable thread above which a helper is added
+        std::chrono::microseconds _maxDelay{std::chrono::milliseconds(1)};      ///< Queueing delay above which a helper is added
+        std::chrono::microseconds _blockedAfter{std::chrono::milliseconds(10)}; ///< A task running longer blocks its worker
+        std::chrono::microseconds _idleTimeout{std::chrono::milliseconds(100)}; ///< Idle time after which a helper retires
+        std::chrono::microseconds _interval{std::chrono::milliseconds(1)};      ///< Sampling period of the load monitor
+    };
+
+    /**
+     * @brief Priority lane of a task
+     */
+    struct Priority
+    {
+        enum type : uint8_t
+        {
+            REAL_TIME,
+            NORMAL,
+            BACKGROUND,
+        };
+
+        static constexpr size_t COUNT = 3;
+    };
+
+    /**
+     * @brief Queueing delay of the tasks of one lane, from submission to start
+     */
+    struct QueueStatistics
+    {
+        uint64_t _count = 0;                         ///< Number of started tasks
+        std::chrono::nanoseconds _totalDelay{0};     ///< Sum of the queueing delays
+        std::chrono::nanoseconds _maxDelay{0};       ///< Longest queueing delay
+        uint64_t _missedDeadlines = 0;               ///< Tasks started after their deadline (deadline lane only)
+
+        /// @brief Gets the mean queueing delay.
+        inline auto mean() const noexcept -> std::chrono::nanoseconds
+        {
+            return _count > 0 ? _totalDelay / static_cast<int64_t>(_count) : std::chrono::nanoseconds(0);
+        }
+    };
+
 private :
+    struct DeadlineTask
+    {
+        int64_t _deadline = 0;
+        int64_t _enqueued = 0;
+        Task _task;
+    };
+
+    struct alignas(64) LaneCounters
+    {
+        std::atomic<uint64_t> _count{0};
+        std::atomic<uint64_t> _totalDelay{0};
+        std::atomic<uint64_t> _maxDelay{0};
+        std::atomic<uint64_t> _missed{0};
+    };
+
+    struct alignas(64) WorkerState
+    {
+        int64_t _since = 0; ///< Start of the current idle period, 0 while busy
+        int64_t _gap = 0;   ///< Smoothed time from running out of work to the next task
+        std::atomic<int64_t> _started{0}; ///< Start of the running task, 0 if idle (elastic mode only)
+    };
+
+    struct alignas(64) WorkerCounters
+    {
+        std::atomic<uint64_t> _tasks{0};
+        std::atomic<uint64_t> _stealAttempts{0};
+        std::atomic<uint64_t> _steals{0};
+        std::atomic<uint64_t> _parks{0};
+        std::atomic<uint64_t> _idleTime{0};
+        utils::AtomicHistogram _waitTime;
+        utils::AtomicHistogram _runTime;
+    };
+
+    /// @brief Statistics slot of the deadline lane, after the priority lanes.
+    static constexpr size_t DEADLINE_LANE = Priority::COUNT;
+    static constexpr size_t LANE_COUNT = Priority::COUNT + 1;
+
+private :
+    const Mode::type _mode;
+    const uint32_t _threadCount;
+    const Placement::type _placement;
     std::atomic<bool> _running{false};
     std::atomic<uint32_t> _index{0};
     
     std::vector<std::tuple<std::future<void>, std::shared_ptr<Thread>>> _workers;
     std::vector<std::shared_ptr<WorkQueue>> _queues;
 
+    // Steal order of every worker, workers on the same NUMA node first
+    std::vector<std::vector<uint32_t>> _victims;
+    std::vector<uint32_t> _nodes;
+
+    // Mode::LOCK_FREE only, one deque per worker and priority at [worker * Priority::COUNT + priority]
+    std::vector<std::unique_ptr<LockFreeWorkQueue<QueuedTask*>>> _deques;
+    std::array<CircularDeque<QueuedTask*>, Priority::COUNT> _injector;
+    std::mutex _injectorLock;
+    std::array<std::atomic<size_t>, Priority::COUNT> _injectorSize{};
+
+    std::mutex _parkLock;
+    std::condition_variable _parkCv;
+    std::atomic<uint64_t> _epoch{0};
+    std::atomic<uint32_t> _sleepers{0};
+
+    std::atomic<uint8_t> _idleStrategy{IdlePolicy::Strategy::SPIN};
+    std::atomic<int64_t> _idleSpin{0};
+    std::atomic<int64_t> _idleYield{0};
+    std::unique_ptr<WorkerState[]> _states;
+
+    // Elastic mode, helper threads are started and reaped by the load monitor
+    Elasticity _elasticity;
+    std::atomic<bool> _elastic{false};
+    std::mutex _elasticLock;
+    std::condition_variable _elasticCv;
+    std::tuple<std::future<void>, std::shared_ptr<Thread>> _monitor;
+    std::vector<std::tuple<std::future<void>, std::shared_ptr<Thread>>> _helpers;
+    std::atomic<uint32_t> _helperCount{0};
+    std::atomic<uint64_t> _delaySample{0};
+
+    // Earliest-deadline-first heap, served through REAL_TIME trampoline tasks
+    std::vector<DeadlineTask> _deadlines;
+    std::mutex _deadlineLock;
+
+    // One set of lane counters per worker plus one for other threads
+    std::atomic<bool> _statistics{false};
+    std::unique_ptr<LaneCounters[]> _counters;
+
+    // Telemetry, one slot per worker plus one for other threads
+    std::atomic<bool> _telemetry{false};
+    std::unique_ptr<WorkerCounters[]> _workerCounters;
+
 private :
     /**
      * @brief Factory method to create a TaskExecutor instance
      * @param threadCount Number of worker threads to create
+     * @param mode Queueing strategy of the worker threads
+     * @param placement CPU placement of the worker threads
      * @return Shared pointer to the created TaskExecutor instance
      */
-    static auto __create(uint32_t threadCount) noexcept -> std::shared_ptr<TaskExecutor>
+    static auto __create(uint32_t threadCount, 
+                         Mode::type mode = Mode::LOCKED,
+                         Placement::type placement = Placement::NONE) noexcept -> std::shared_ptr<TaskExecutor>
     {
-        return std::shared_ptr<TaskExecutor>(new TaskExecutor(threadCount));
+        return std::shared_ptr<TaskExecutor>(new TaskExecutor(threadCount, mode, placement));
     }
 
 public :
     /**
      * @brief Constructor that initializes the thread pool with specified number of threads
      * @param threadCount Number of worker threads to create (will be adjusted to next power of 2)
+     * @param mode Queueing strategy of the worker threads
+     * @param placement CPU placement of the worker threads
      * 
      * Creates a thread pool with the specified number of threads. The actual thread count
      * is adjusted to the next power of 2 for efficient bit masking operations.
      * Each thread runs a work-stealing loop that processes tasks from its own queue
      * and steals work from other queues when idle.
+     * 
+     * With a Placement other than NONE the workers are spread evenly over the CPUs the
+     * process may use, in NUMA node order, so that consecutive workers share a node.
      */
-    explicit TaskExecutor(uint32_t threadCount) noexcept
-    {
-        const uint32_t adjustedThreadCount = utils::next_pwr_of_2(threadCount);
-        _running.store(true);
-        _workers.reserve(adjustedThreadCount);
-        _queues.reserve(adjustedThreadCount);
-
-        for(uint32_t i = 0; i < adjustedThreadCount; ++i)
-        {
-            auto queue = std::make_shared<WorkQueue>();
-            _queues.push_back(std::move(queue));
-        }
-
-        for(uint32_t i = 0; i < adjustedThreadCount; ++i)
-        {
-            auto worker = Thread::create();
-            auto future = worker->start([index = i, this]() mutable {
-                while(_running.load())
-                {
-                    auto task = _queues[index]->pop(_running);
-                    if (task) { task(); }
-                    
-                    if (_queues[index]->empty())
-                    {
-                        for (size_t i = 1; i < _queues.size(); ++i) 
-                        {
-                            if (!_running.load()) { break; }
-                            size_t targetIndex = (index + i) % _queues.size();
-                            task = _queues[targetIndex]->try_steal();
-                            if (task) 
-                            {
-                                task();
-                                break;
-                            }
-                        }
-                    }
-                }
-            });
-            _workers.push_back({std::move(future), std::move(worker)});
-        }
-    }
+    explicit TaskExecutor(uint32_t threadCount, 
+                          Mode::type mode = Mode::LOCKED,
+                          Placement::type placement = Placement::NONE) noexcept;
 
     /**
      * @brief Destructor that stops all worker threads
      * 
      * Ensures all worker threads are properly stopped and joined before destruction.
      */
-    ~TaskExecutor() noexcept { stop(); }
+    ~TaskExecutor() noexcept;
 
 public :    
     /**
      * @brief Submits a task for execution by the thread pool
      * @tparam ReturnType The return type of the task function
-     * @param task The task function to execute
+     * @param task The task function to execute, any callable invocable as @c task()
+     * @param priority The lane to queue the task in
      * @return A future object that can be used to retrieve the task result
      * 
      * Distributes the task to one of the worker threads using round-robin scheduling.
      * The task is added to a work queue and will be executed by an available worker thread.
+     * In Mode::LOCK_FREE, a task loaded from one of this executor's worker threads is
+     * pushed to the calling worker's own deque instead.
+     */
+    template <typename ReturnType, typename Function>
+    auto load(Function&& task, Priority::type priority = Priority::NORMAL) noexcept -> std::future<ReturnType>
+    {
+        auto [wrapped, future] = make_task<ReturnType>(std::forward<Function>(task));
+        schedule(std::move(wrapped), priority);
+        return std::move(future);
+    }
+
+    /**
+     * @brief Submits a task that should start before @p deadline
+     * @tparam ReturnType The return type of the task function
+     * @param deadline Point in time the task should have started by
+     * @param task The task function to execute, any callable invocable as @c task()
+     * @return A future object that can be used to retrieve the task result
+     * 
+     * Deadline tasks are kept in one executor-wide queue ordered by deadline and
+     * run ahead of Priority::NORMAL tasks, the earliest deadline first. A missed
+     * deadline does not drop the task, it is counted in get_deadline_statistics().
+     */
+    template <typename ReturnType, typename Function>
+    auto load_by(std::chrono::steady_clock::time_point deadline, Function&& task) noexcept -> std::future<ReturnType>
+    {
+        auto [wrapped, future] = make_task<ReturnType>(std::forward<Function>(task));
+        schedule_by(deadline, std::move(wrapped));
+        return std::move(future);
+    }
+
+    /**
+     * @brief Submits a task for execution without creating a future
+     * @param task The task function to execute, any callable invocable as @c task()
+     * @param priority The lane to queue the task in
+     * 
+     * Fire-and-forget variant of load(). No promise/future shared state is created,
+     * so the caller cannot wait for the task or observe its result. An exception
+     * thrown by the task is discarded.
+     */
+    template <typename Function>
+    auto post(Function&& task, Priority::type priority = Priority::NORMAL) noexcept -> void
+    {
+        schedule(wrap(std::forward<Function>(task)), priority);
+    }
+
+    /**
+     * @brief Submits an already wrapped task without creating a future
+     * @param task The task to execute. It is scheduled as is and must not throw.
+     * @param priority The lane to queue the task in
+     */
+    auto post(Task&& task, Priority::type priority = Priority::NORMAL) noexcept -> void
+    {
+        schedule(std::move(task), priority);
+    }
+
+    /**
+     * @brief Submits a task that should start before @p deadline, without creating a future
+     * @see load_by(), post()
+     */
+    template <typename Function>
+    auto post_by(std::chrono::steady_clock::time_point deadline, Function&& task) noexcept -> void
+    {
+        schedule_by(deadline, wrap(std::forward<Function>(task)));
+    }
+
+    /**
+     * @brief Submits a range of tasks for execution by the thread pool
+     * @tparam ReturnType The common return type of the tasks
+     * @param first Iterator to the first task
+     * @param last Iterator past the last task
+     * @param priority The lane to queue the tasks in
+     * @return One future per task, in the order of the range
+     * 
+     * The tasks are split into contiguous chunks, one per worker queue, and each
+     * queue is locked and notified once per call instead of once per task. In
+     * Mode::LOCK_FREE the whole range enters the injection queue (or the calling
+     * worker's own deque) at once and at most one parked worker per task is woken.
+     * Tasks are copied from the range unless move iterators are passed.
+     */
+    template <typename ReturnType, typename Iterator>
+    auto load_bulk(Iterator first, Iterator last, Priority::type priority = Priority::NORMAL) noexcept -> std::vector<std::future<ReturnType>>
+    {
+        std::vector<Task> tasks;
+        std::vector<std::future<ReturnType>> futures;
+        if constexpr (is_forward_iterator<Iterator>)
+        {
+            const auto count = static_cast<size_t>(std::distance(first, last));
+            tasks.reserve(count);
+            futures.reserve(count);
+        }
+
+        for(; first != last; ++first)
+        {
+            auto [wrapped, future] = make_task<ReturnType>(*first);
+            tasks.push_back(std::move(wrapped));
+            futures.push_back(std::move(future));
+        }
+        schedule_bulk(tasks.data(), tasks.size(), priority);
+        return futures;
+    }
+
+    /**
+     * @brief Submits all tasks of a container for execution by the thread pool
+     * @tparam ReturnType The common return type of the tasks
+     * @param tasks Container of tasks. The tasks are moved out if it is an rvalue.
+     * @param priority The lane to queue the tasks in
+     * @return One future per task, in the order of the container
+     */
+    template <typename ReturnType, typename Range>
+    auto load_bulk(Range&& tasks, Priority::type priority = Priority::NORMAL) noexcept -> std::vector<std::future<ReturnType>>
+    {
+        if constexpr (std::is_lvalue_reference_v<Range>)
+        {
+            return load_bulk<ReturnType>(std::begin(tasks), std::end(tasks), priority);
+        }
+        else
+        {
+            return load_bulk<ReturnType>(std::make_move_iterator(std::begin(tasks)),
+                                         std::make_move_iterator(std::end(tasks)), priority);
+        }
+    }
+
+    /**
+     * @brief Submits a range of tasks without creating futures
+     * @param first Iterator to the first task
+     * @param last Iterator past the last task
+     * @param priority The lane to queue the tasks in
+     * 
+     * Fire-and-forget variant of load_bulk(), see post().
      */
-    template <typename ReturnType>
-    auto load(std::function<ReturnType()>&& task) noexcept -> std::future<ReturnType>
+    template <typename Iterator>
+    auto post_bulk(Iterator first, Iterator last, Priority::type priority = Priority::NORMAL) noexcept -> void
     {
-        const uint32_t queueIndex = _index.fetch_add(1) & (_queues.size() - 1);
-        return _queues[queueIndex]->push(std::move(task));
+        std::vector<Task> tasks;
+        if constexpr (is_forward_iterator<Iterator>)
+        {
+            tasks.reserve(static_cast<size_t>(std::distance(first, last)));
+        }
+
+        for(; first != last; ++first) { tasks.push_back(wrap(*first)); }
+        schedule_bulk(tasks.data(), tasks.size(), priority);
+    }
+
+    /**
+     * @brief Submits all tasks of a container without creating futures
+     * @param tasks Container of tasks. The tasks are moved out if it is an rvalue.
+     * @param priority The lane to queue the tasks in
+     */
+    template <typename Range>
+    auto post_bulk(Range&& tasks, Priority::type priority = Priority::NORMAL) noexcept -> void
+    {
+        if constexpr (std::is_lvalue_reference_v<Range>)
+        {
+            post_bulk(std::begin(tasks), std::end(tasks), priority);
+        }
+        else
+        {
+            post_bulk(std::make_move_iterator(std::begin(tasks)),
+                      std::make_move_iterator(std::end(tasks)), priority);
+        }
     }
 
+    /**
+     * @brief Runs one pending task on the calling thread, if there is any
+     * @return True if a task was executed, false if no task could be taken
+     * 
+     * Lets a thread that waits for work submitted to this executor help instead of
+     * blocking, which also keeps nested waits on worker threads from deadlocking.
+     * A worker thread prefers its own queue, other threads take from the injection
+     * queue (Mode::LOCK_FREE) and then steal from the worker queues. May return
+     * false spuriously while another thread holds a queue lock.
+     */
+    auto try_run_one() -> bool;
+
     /**
      * @brief Stops all worker threads and waits for them to complete
      * 
      * Sets the running flag to false, finalizes all work queues to wake up
      * waiting threads, and waits for all worker threads to complete their
-     * current tasks and terminate.
+     * current tasks and terminate. Tasks that were never started are discarded.
+     */
+    auto stop() noexcept -> void;
+
+    /**
+     * @brief Gets the queueing strategy of the executor.
+     * 
+     * @return The mode given at construction time.
+     */
+    inline auto get_mode() const noexcept -> Mode::type { return _mode; }
+
+    /**
+     * @brief Checks whether the worker threads are running.
+     * 
+     * @return False once stop() has been called.
      */
-    auto stop() noexcept -> void
+    inline auto is_running() const noexcept -> bool { return _running.load(); }
+
+    /**
+     * @brief Gets the number of worker threads.
+     * 
+     * @return The thread count given at construction time, rounded up to a power of 2.
+     */
+    inline auto get_thread_count() const noexcept -> uint32_t { return _threadCount; }
+
+    /**
+     * @brief Gets the CPU placement of the worker threads.
+     */
+    inline auto get_placement() const noexcept -> Placement::type { return _placement; }
+
+    /**
+     * @brief Gets the NUMA node a worker thread was placed on.
+     * 
+     * @param index Index of the worker, less than get_thread_count().
+     * @return The node id, 0 for every worker with Placement::NONE.
+     */
+    inline auto get_node(uint32_t index) const noexcept -> uint32_t { return _nodes[index]; }
+
+    /**
+     * @brief Sets what the workers do when they run out of work.
+     * 
+     * The policy is picked up the next time a worker runs out of work; a worker that
+     * is already parked stays parked until a task is submitted.
+     * 
+     * With IdlePolicy::Strategy::ADAPTIVE every worker measures the time between running
+     * out of work and receiving the next task. It spins and yields for at most twice
+     * that time, bounded by _spin and _yield, and parks right away while tasks arrive
+     * further apart than _spin + _yield.
+     * 
+     * IdlePolicy::Strategy::BUSY_POLL gives the lowest wake-up latency but keeps every
+     * worker on a CPU at all times. Use it only for pools that have CPUs to themselves.
+     */
+    auto set_idle_policy(const IdlePolicy& policy) noexcept -> void;
+
+    /**
+     * @brief Gets the idle policy of the workers.
+     */
+    auto get_idle_policy() const noexcept -> IdlePolicy;
+
+    /**
+     * @brief Makes the pool grow and shrink with the load.
+     * 
+     * The workers created at construction time always stay. A load monitor samples
+     * the pool every _interval and adds one helper thread per sample while more than
+     * _queueDepth tasks per runnable thread are pending or a task waited longer than
+     * _maxDelay. A worker whose task runs longer than _blockedAfter counts as blocked
+     * and is replaced by a helper as long as tasks are pending. Workers plus helpers
+     * never exceed _maxThreads. A helper that finds no task for _idleTimeout retires.
+     * 
+     * Helpers do not own a queue: they steal queued tasks like a thread calling
+     * try_run_one(). A _maxThreads of at most get_thread_count() turns the monitor off,
+     * running helpers then retire once they are idle.
+     */
+    auto set_elasticity(const Elasticity& elasticity) -> void;
+
+    /**
+     * @brief Gets the growth and shrink rules of the pool.
+     */
+    auto get_elasticity() noexcept -> Elasticity;
+
+    /**
+     * @brief Gets the number of running helper threads.
+     */
+    inline auto get_helper_count() const noexcept -> uint32_t { return _helperCount.load(); }
+
+    /**
+     * @brief Enables or disables the per-worker telemetry.
+     * 
+     * Telemetry costs two clock reads and a few uncontended atomic additions per task
+     * and is disabled by default.
+     */
+    inline auto set_telemetry_enabled(bool enabled) noexcept -> void { _telemetry.store(enabled); }
+
+    /**
+     * @brief Takes a snapshot of the per-worker telemetry.
+     * 
+     * @return One entry per worker, in worker order, followed by one entry for the tasks
+     *         that other threads ran, e.g. through try_run_one() or elastic helpers. The
+     *         last entry's _queueDepth holds the tasks waiting in the injection queue.
+     */
+    auto get_telemetry() const -> std::vector<WorkerTelemetry>;
+
+    /**
+     * @brief Clears the per-worker telemetry.
+     */
+    auto reset_telemetry() noexcept -> void;
+
+    /**
+     * @brief Enables or disables recording of queueing delays.
+     * 
+     * Recording costs two clock reads per task and is disabled by default. Tasks
+     * that were queued while recording was disabled are not counted.
+     */
+    inline auto set_statistics_enabled(bool enabled) noexcept -> void { _statistics.store(enabled); }
+
+    /**
+     * @brief Gets the queueing delay statistics of a priority lane.
+     */
+    auto get_statistics(Priority::type priority) const noexcept -> QueueStatistics;
+
+    /**
+     * @brief Gets the queueing delay statistics of the deadline tasks.
+     */
+    auto get_deadline_statistics() const noexcept -> QueueStatistics;
+
+    /**
+     * @brief Clears all queueing delay statistics.
+     */
+    auto reset_statistics() noexcept -> void;
+
+private :
+    template <typename Iterator>
+    static constexpr bool is_forward_iterator =
+        std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
+    template <typename Function>
+    static auto wrap(Function&& task) -> Task
     {
-        if(!_running.load()) { return; }
+        return Task([func = std::forward<Function>(task)]() mutable {
+            try { func(); }
+            catch(...) {}
+        });
+    }
 
-        _running.store(false);
-        const auto threadCount = _workers.size();
-        for(size_t i = 0; i < threadCount; ++i)
-        {
-            _queues[i]->finalize();
-            std::get<0>(_workers[i]).wait();
-        }
-        _workers.clear();
+    auto place() -> std::vector<std::vector<uint32_t>>;
+    auto run_locked(uint32_t index) -> void;
+    auto run_lock_free(uint32_t index) -> void;
+
+    auto schedule(Task&& task, Priority::type priority, bool record = true) noexcept -> void;
+    auto schedule_bulk(Task* tasks, size_t count, Priority::type priority) noexcept -> void;
+    auto schedule_by(std::chrono::steady_clock::time_point deadline, Task&& task) noexcept -> void;
+    auto run_deadline() -> void;
+    auto execute(QueuedTask& task, size_t lane) -> void;
+    auto record(size_t lane, int64_t enqueued, int64_t deadline = 0) noexcept -> void;
+    auto timestamp() const noexcept -> int64_t;
+    auto collect(size_t lane) const noexcept -> QueueStatistics;
+    auto slot() const noexcept -> uint32_t;
+    auto telemetry() noexcept -> WorkerCounters*;
+    auto count_steals(size_t attempts, bool stolen) noexcept -> void;
+
+    auto deque(uint32_t index, size_t priority) const noexcept -> LockFreeWorkQueue<QueuedTask*>&
+    {
+        return *_deques[index * Priority::COUNT + priority];
     }
+    auto find_task(uint32_t index, size_t& lane) noexcept -> QueuedTask*;
+    auto steal_task(uint32_t start, size_t& lane) noexcept -> QueuedTask*;
+    auto has_task() const noexcept -> bool;
+    auto pending() const noexcept -> size_t;
+    auto run_monitor() -> void;
+    auto run_helper(std::chrono::nanoseconds idleTimeout) -> void;
+    auto idle(uint32_t index) noexcept -> bool;
+    auto busy(uint32_t index) noexcept -> void;
+    auto park(std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max()) noexcept -> void;
+    auto signal(size_t count = 1) noexcept -> void;
 };
 } // namespace common::threading
\ No newline at end of file
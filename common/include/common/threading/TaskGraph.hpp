@@ -0,0 +1,109 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/threading/Future.hpp"
+#include "common/threading/TaskExecutor.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace common::threading
+{
+/**
+ * @class TaskGraph
+ * @brief A reusable dependency graph of tasks executed on a TaskExecutor
+ * 
+ * Tasks are added with emplace() and ordered with precede(). run() posts every task
+ * without predecessors; whenever a task completes, the successors whose
+ * predecessors are all done are scheduled right away (one of them continues on the
+ * same worker). No thread blocks while the graph runs.
+ * 
+ * If a task throws, the tasks that have not started yet are skipped and the first
+ * exception is delivered through the future returned by run().
+ */
+class COMMON_LIB_API TaskGraph final : public NonCopyable
+{
+public :
+    using Node = size_t;
+
+private :
+    struct Vertex
+    {
+        std::function<void()> _task;
+        std::vector<Node> _successors;
+        uint32_t _predecessors = 0;
+    };
+
+    struct Execution;
+
+private :
+    std::vector<Vertex> _nodes;
+
+public :
+    TaskGraph() = default;
+
+public :
+    /**
+     * @brief Adds a task to the graph
+     * @param task Any copyable callable invocable as @c task()
+     * @return Handle of the new node
+     */
+    template <typename Function>
+    auto emplace(Function&& task) -> Node
+    {
+        _nodes.push_back(Vertex{std::function<void()>(std::forward<Function>(task)), {}, 0});
+        return _nodes.size() - 1;
+    }
+
+    /**
+     * @brief Makes @p after wait for @p before
+     * @throws OutOfRangeException If one of the nodes does not belong to the graph.
+     */
+    auto precede(Node before, Node after) -> void;
+
+    /**
+     * @brief Gets the number of tasks in the graph
+     */
+    inline auto size() const noexcept -> size_t { return _nodes.size(); }
+
+    /**
+     * @brief Executes the graph on @p executor
+     * 
+     * The graph is copied into the execution, so it can be modified, run again or
+     * destroyed while the execution is in progress.
+     *
+     * @return A future that becomes ready once every task has finished.
+     * @throws BadHandlingException If the graph contains a cycle.
+     */
+    auto run(TaskExecutor& executor) const -> Future<void>;
+
+private :
+    static auto execute(const std::shared_ptr<Execution>& execution, Node node) noexcept -> void;
+};
+} // namespace common::threading
@@ -30,6 +30,8 @@ SOFTWARE.
 #include "common/Factory.hpp"
 
 #include <future>
+#include <string>
+#include <vector>
 #if defined(WIN32)
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
@@ -96,6 +98,64 @@ public :
     using Priority = std::tuple<Policies::type, Level::type>;
 #endif
 
+    /**
+     * @brief Outcome of one item of a Config
+     */
+    struct Outcome
+    {
+        enum type : uint8_t
+        {
+            NOT_REQUESTED,  ///< The item was left at its default
+            APPLIED,        ///< The item is in effect
+            FAILED,         ///< The system refused the item, the reason is logged
+        };
+    };
+
+    /**
+     * @brief Setup applied by the new thread before it calls the function given to start()
+     *
+     * Meant for real-time threads, which should neither migrate nor page fault once they run.
+     */
+    struct Config
+    {
+        std::vector<uint32_t> _affinity;    ///< CPUs the thread may run on, empty keeps the inherited affinity
+        bool _isolatedCore = false;         ///< Pin to one isolated CPU (isolcpus) instead, falls back to _affinity
+#if defined(WIN32)
+        Priority _priority = Policies::DEFAULT;
+#elif defined(LINUX)
+        Priority _priority = {Policies::DEFAULT, Level::DEFAULT};
+#endif
+        size_t _stackSize = 0;              ///< Stack size in bytes, 0 keeps the system default
+        size_t _prefaultStack = 0;          ///< Bytes of stack touched before the function runs
+        bool _lockMemory = false;           ///< Lock all current and future pages of the process in memory
+    };
+
+    /**
+     * @brief What the thread made of its Config, see get_report()
+     */
+    struct Report
+    {
+        Outcome::type _affinity = Outcome::NOT_REQUESTED;
+        Outcome::type _isolatedCore = Outcome::NOT_REQUESTED;
+        Outcome::type _priority = Outcome::NOT_REQUESTED;
+        Outcome::type _stackSize = Outcome::NOT_REQUESTED;
+        Outcome::type _prefaultStack = Outcome::NOT_REQUESTED;
+        Outcome::type _lockMemory = Outcome::NOT_REQUESTED;
+        std::vector<uint32_t> _cpus;        ///< CPUs the thread was restricted to, empty if none
+
+        /**
+         * @brief Checks that no requested item failed.
+         */
+        inline auto succeeded() const noexcept -> bool
+        {
+            for(auto outcome : {_affinity, _isolatedCore, _priority, _stackSize, _prefaultStack, _lockMemory})
+            {
+                if(outcome == Outcome::FAILED) return false;
+            }
+            return true;
+        }
+    };
+
 private :
     /**
      * @brief Creates a new thread object.
@@ -114,10 +174,15 @@ public :
 
 public :
     /**
-     * @brief Creates a detached thread and executes the given function asynchronously.
+     * @brief Executes the given function asynchronously on a detached thread.
+     * 
+     * The thread is taken from a pool of parked threads, a new one is only started when
+     * none is parked, so calls never wait for each other. The thread has the default name
+     * and priority when the function starts, whatever the previous function set.
      * 
      * @param func The function to be executed in the new thread.
-     * @return A future object to synchronize the execution of the function.
+     * @return A future object to synchronize the execution of the function. It holds the
+     *         exception if the function throws.
      */
     static auto async(std::function<void()>&& func) noexcept -> std::future<void>;
 
@@ -199,6 +264,56 @@ public :
      */
     virtual auto get_name() const noexcept -> const std::string& = 0;
 
+    /**
+     * @brief Restricts the thread to a set of CPUs.
+     * 
+     * Can be called before or after the thread starts. If called before start(),
+     * the affinity will be applied during thread initialization.
+     * 
+     * @param cpus Indices of the CPUs the thread may run on. An empty set keeps the
+     *             affinity inherited from the creating thread.
+     * @return True if the affinity was successfully set, false if the system call failed.
+     *         Always returns true when called before thread starts.
+     * 
+     * @throws BadHandlingException If the thread is started but not joinable (invalid state).
+     * @note On Windows only the first 64 CPUs can be selected.
+     */
+    virtual auto set_affinity(const std::vector<uint32_t>& cpus) -> bool = 0;
+
+    /**
+     * @brief Gets the CPUs the thread is restricted to.
+     * 
+     * @return The set given to set_affinity(), empty if none was given.
+     */
+    virtual auto get_affinity() const noexcept -> const std::vector<uint32_t>& = 0;
+
+    /**
+     * @brief Sets up the thread for start().
+     * 
+     * Replaces the priority and the affinity set so far with those of the config when it
+     * requests them. Everything else is applied by the new thread, in the order memory lock,
+     * affinity, priority and stack prefault, before it calls the function given to start().
+     * 
+     * @param config The setup to apply.
+     * 
+     * @throws AlreadyRunningException If the thread is running.
+     * @note _lockMemory affects the whole process and stays in effect after the thread ends.
+     *       _stackSize and _lockMemory are not supported on Windows and are reported as failed.
+     */
+    virtual auto set_config(const Config& config) -> void = 0;
+
+    /**
+     * @brief Gets the config given to set_config().
+     */
+    virtual auto get_config() const noexcept -> const Config& = 0;
+
+    /**
+     * @brief Gets what the last start() made of the config.
+     * 
+     * @return The report, complete as soon as start() has returned.
+     */
+    virtual auto get_report() const noexcept -> Report = 0;
+
     /**
      * @brief Gets the thread ID.
      * 
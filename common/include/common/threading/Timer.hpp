@@ -27,6 +27,7 @@ SOFTWARE.
 #include "common/CommonHeader.hpp"
 #include "common/NonCopyable.hpp"
 #include "common/Factory.hpp"
+#include "common/utils/Histogram.hpp"
 
 #include <functional>
 #include <memory>
@@ -43,6 +44,16 @@ namespace common::threading
  * The task can be stopped by calling stop(), and the timer started by start() will be stopped.
  * If the task is stopped, running() will return false.
  *
+ * Timers own no thread. They are handles to entries of a process wide TimerService,
+ * and the functions of all timers run on a small shared pool of threads, so a
+ * function should not block for long.
+ *
+ * By default the next call is scheduled one interval after the previous call
+ * returned. Schedule::FIXED_RATE instead schedules every call against absolute
+ * deadlines, so the average rate does not drift with the run time of the function.
+ * Backend::PRECISE gives the timer a thread of its own that sleeps on an absolute
+ * deadline (a timerfd on Linux), for periods below the resolution of the shared service.
+ *
  * @note A derived class must implement the pure virtual functions start() and stop() to execute a task.
  */
 class COMMON_LIB_API Timer : public NonCopyable, 
@@ -54,6 +65,60 @@ public :
     using Function = std::function<bool()>;
     using Interval = std::chrono::microseconds;
 
+    /**
+     * @brief How the deadline of the next call is derived
+     */
+    struct Schedule
+    {
+        enum type : uint8_t
+        {
+            FIXED_DELAY,    ///< One interval after the previous call returned (default)
+            FIXED_RATE,     ///< One interval after the previous deadline
+        };
+    };
+
+    /**
+     * @brief What a FIXED_RATE timer does with deadlines that passed while the function was running
+     */
+    struct Overrun
+    {
+        enum type : uint8_t
+        {
+            SKIP,       ///< Drop them and wait for the next deadline in the future (default)
+            CATCH_UP,   ///< Call the function for each of them right away
+        };
+    };
+
+    /**
+     * @brief What wakes the timer up
+     */
+    struct Backend
+    {
+        enum type : uint8_t
+        {
+            SHARED,     ///< The shared TimerService, millisecond resolution (default)
+            PRECISE,    ///< A dedicated thread sleeping on an absolute deadline
+        };
+    };
+
+    struct Options
+    {
+        Schedule::type _schedule = Schedule::FIXED_DELAY;
+        Overrun::type _overrun = Overrun::SKIP;
+        Backend::type _backend = Backend::SHARED;
+    };
+
+    /**
+     * @brief Counters of a timer, see get_statistics()
+     */
+    struct Statistics
+    {
+        uint64_t _calls = 0;        ///< Calls of the function
+        uint64_t _overruns = 0;     ///< Deadlines that passed while the function was still running
+        uint64_t _skipped = 0;      ///< Deadlines dropped by Overrun::SKIP
+        utils::Histogram _jitter;   ///< Delay between each deadline and the start of the call in nanoseconds
+    };
+
 public :
     ~Timer() noexcept = default;
 
@@ -63,10 +128,12 @@ private :
      *
      * @param func The function to execute at the specified interval.
      * @param interval The interval at which the function should be executed.
+     * @param options Scheduling mode and backend of the timer.
      *
      * @return A new timer that can execute the given function at the specified interval.
      */
     static auto __create(Function&& func, Interval interval) noexcept -> std::unique_ptr<Timer, std::function<void(Timer*)>>;
+    static auto __create(Function&& func, Interval interval, Options options) noexcept -> std::unique_ptr<Timer, std::function<void(Timer*)>>;
 
 public :
     /**
@@ -74,10 +141,12 @@ public :
      *
      * @param func The function to execute at the specified interval.
      * @param interval The interval at which the function should be executed.
+     * @param options Scheduling mode and backend of the timer.
      *
      * @return A future that can be used to wait for the timer to finish.
      */
     static auto async(Function&& func, Interval interval) noexcept -> std::future<void>;
+    static auto async(Function&& func, Interval interval, Options options) noexcept -> std::future<void>;
 
 public :
     /**
@@ -99,6 +168,11 @@ public :
      * @return true if the timer is running, false otherwise.
      */
     virtual auto status() noexcept -> bool = 0;
+
+    /**
+     * @brief Snapshot of the counters recorded since the timer was created.
+     */
+    virtual auto get_statistics() const noexcept -> Statistics = 0;
 };
 
 namespace detail
@@ -0,0 +1,211 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/threading/Task.hpp"
+#include "common/threading/TaskExecutor.hpp"
+#include "common/threading/Thread.hpp"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace common::threading
+{
+/**
+ * @class TimerService
+ * @brief One thread serving any number of one-shot timers through a hierarchical timing wheel
+ *
+ * Time is cut into ticks. The wheel has LEVELS levels of 64 slots; level 0 holds the
+ * timers due within the next 64 ticks one slot per tick, level 1 the timers due
+ * within the next 64 * 64 ticks one slot per 64 ticks, and so on. When the wheel
+ * turns past a slot of a higher level, its timers are moved down to a finer level.
+ * Timers are entries of a slab linked into their slot, so schedule() and cancel() are
+ * O(1) and never allocate once the slab has grown to the number of live timers.
+ *
+ * The service thread sleeps until the next slot that holds a timer or has to be
+ * moved down, not on every tick. Callbacks are never run early and run at most one
+ * tick late plus the dispatch latency.
+ *
+ * Expired callbacks are handed to the Dispatcher given at creation: a TaskExecutor,
+ * common::asio::IOContext::timer_dispatcher(), or, without a dispatcher, the service
+ * thread itself, in which case callbacks must be short.
+ */
+class COMMON_LIB_API TimerService final : public NonCopyable,
+                                          public Factory<TimerService>
+{
+    friend class Factory<TimerService>;
+
+public :
+    using Clock = std::chrono::steady_clock;
+    using Dispatcher = std::function<void(Task&&)>;
+
+    static constexpr size_t LEVELS = 6;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t(1) << SLOT_BITS;
+
+    /**
+     * @brief Identifies a scheduled timer, see cancel()
+     */
+    struct Handle
+    {
+        uint32_t _index = UINT32_MAX;
+        uint32_t _generation = 0;
+
+        inline explicit operator bool() const noexcept { return _index != UINT32_MAX; }
+    };
+
+private :
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct Entry
+    {
+        Task _callback;
+        uint64_t _expiry = 0;
+        uint32_t _prev = NONE;
+        uint32_t _next = NONE;
+        uint32_t _generation = 0;
+        uint8_t _level = 0;
+        uint8_t _slot = 0;
+        bool _active = false;
+    };
+
+    const Dispatcher _dispatcher;
+    const std::chrono::nanoseconds _tick;
+    const Clock::time_point _start;
+
+    mutable std::mutex _lock;
+    std::condition_variable _cv;
+    std::vector<Entry> _entries;
+    uint32_t _free = NONE;
+    std::array<std::array<uint32_t, SLOTS>, LEVELS> _slots;
+    std::array<uint64_t, LEVELS> _occupied{};
+    uint64_t _current = 0;          ///< Next tick to process
+    uint64_t _wakeTick = UINT64_MAX; ///< Tick the service thread sleeps until
+    size_t _count = 0;
+    bool _running = true;
+
+    std::shared_ptr<Thread> _thread;
+    std::future<void> _future;
+    std::thread::id _threadId;
+
+private :
+    /**
+     * @brief Factory method to create a TimerService instance
+     * @param dispatcher Runs expired callbacks, nullptr to run them on the service thread
+     * @param tick Resolution of the wheel
+     */
+    static auto __create(Dispatcher dispatcher = nullptr,
+                         std::chrono::nanoseconds tick = std::chrono::milliseconds(1)) noexcept -> std::shared_ptr<TimerService>
+    {
+        return std::shared_ptr<TimerService>(new TimerService(std::move(dispatcher), tick));
+    }
+
+    /**
+     * @brief Factory method to create a TimerService that runs callbacks on an executor
+     * @param executor Executor the callbacks are posted to
+     * @param tick Resolution of the wheel
+     */
+    static auto __create(std::shared_ptr<TaskExecutor> executor,
+                         std::chrono::nanoseconds tick = std::chrono::milliseconds(1)) noexcept -> std::shared_ptr<TimerService>
+    {
+        return __create([executor = std::move(executor)](Task&& task) { executor->post(std::move(task)); }, tick);
+    }
+
+    TimerService(Dispatcher dispatcher, std::chrono::nanoseconds tick) noexcept;
+
+public :
+    /**
+     * @brief Stops the service thread. Pending timers are dropped without running.
+     */
+    ~TimerService() noexcept;
+
+public :
+    /**
+     * @brief Runs @p callback once @p delay has passed
+     * @return Handle that cancel() accepts, empty if the service is stopped
+     */
+    auto schedule_after(std::chrono::nanoseconds delay, Task&& callback) noexcept -> Handle
+    {
+        return schedule_at(Clock::now() + delay, std::move(callback));
+    }
+
+    template <typename Function>
+    auto schedule_after(std::chrono::nanoseconds delay, Function&& callback) noexcept -> Handle
+    {
+        return schedule_after(delay, Task(std::forward<Function>(callback)));
+    }
+
+    /**
+     * @brief Runs @p callback at @p time
+     * @return Handle that cancel() accepts, empty if the service is stopped
+     */
+    auto schedule_at(Clock::time_point time, Task&& callback) noexcept -> Handle;
+
+    template <typename Function>
+    auto schedule_at(Clock::time_point time, Function&& callback) noexcept -> Handle
+    {
+        return schedule_at(time, Task(std::forward<Function>(callback)));
+    }
+
+    /**
+     * @brief Cancels a timer
+     * @return True if the timer was pending and will not run, false if it already
+     *         expired, was cancelled before or the handle is empty
+     */
+    auto cancel(Handle handle) noexcept -> bool;
+
+    /**
+     * @brief Number of timers waiting to expire
+     */
+    auto pending() const noexcept -> size_t;
+
+    /**
+     * @brief Stops the service thread and drops the pending timers.
+     */
+    auto stop() noexcept -> void;
+
+    inline auto get_tick() const noexcept -> std::chrono::nanoseconds { return _tick; }
+
+private :
+    auto run() -> void;
+    auto to_tick(Clock::time_point time) const noexcept -> uint64_t;
+    auto insert(uint32_t index) noexcept -> void;
+    auto unlink(uint32_t index) noexcept -> void;
+    auto release(uint32_t index) noexcept -> void;
+    auto cascade(size_t level, size_t slot) noexcept -> void;
+    auto expire(size_t slot, std::vector<Task>& expired) noexcept -> void;
+    auto next_tick() const noexcept -> uint64_t;
+};
+} // namespace common::threading
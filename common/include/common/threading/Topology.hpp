@@ -0,0 +1,73 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace common::threading
+{
+/**
+ * @brief A NUMA node and the CPUs that belong to it.
+ */
+struct NumaNode
+{
+    uint32_t _id = 0;
+    std::vector<uint32_t> _cpus;
+};
+
+/**
+ * @brief Parses a CPU list in the Linux sysfs format, e.g. "0-3,8,10-11".
+ *
+ * @param list The list to parse. Malformed entries are skipped.
+ * @return The CPU indices in ascending order, without duplicates.
+ */
+COMMON_LIB_API auto parse_cpu_list(const std::string& list) -> std::vector<uint32_t>;
+
+/**
+ * @brief Gets the NUMA nodes of the machine.
+ *
+ * On Linux the nodes are read from /sys/devices/system/node and only the CPUs the
+ * calling thread may run on are reported, so a process restricted by a cpuset or
+ * taskset sees just its share of the machine. Nodes without usable CPUs are left
+ * out. If the topology cannot be read, a single node 0 holding every CPU is returned.
+ *
+ * @return The nodes in ascending order of their id, never empty.
+ */
+COMMON_LIB_API auto get_numa_nodes() -> std::vector<NumaNode>;
+
+/**
+ * @brief Gets the CPUs isolated from the scheduler (isolcpus).
+ *
+ * On Linux the list is read from /sys/devices/system/cpu/isolated. Other platforms
+ * have no isolated CPUs.
+ *
+ * @return The CPU indices in ascending order, empty if there are none.
+ */
+COMMON_LIB_API auto get_isolated_cpus() -> std::vector<uint32_t>;
+} // namespace common::threading
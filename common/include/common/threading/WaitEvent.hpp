@@ -0,0 +1,81 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace common::threading
+{
+/**
+ * @class WaitEvent
+ * @brief Auto-reset event that one thread waits on and others signal
+ *
+ * On Linux the event is an eventfd, so waiting costs no mutex and get_handle() can
+ * be added to an epoll/poll set. Signals that arrive while nobody waits are kept
+ * until the next wait. Other platforms fall back to a condition variable.
+ */
+class COMMON_LIB_API WaitEvent final : public NonCopyable
+{
+private :
+    int32_t _fd = -1;
+    std::mutex _lock;
+    std::condition_variable _cv;
+    bool _signaled = false;
+
+public :
+    /**
+     * @brief Constructor
+     * @throws RuntimeException If the eventfd cannot be created.
+     */
+    WaitEvent();
+    ~WaitEvent() override;
+
+public :
+    /**
+     * @brief Signals the event, waking the waiting thread.
+     */
+    auto notify() noexcept -> void;
+
+    /**
+     * @brief Waits until the event is signaled and resets it.
+     * 
+     * @param timeout Longest time to wait.
+     * @return True if the event was signaled, false on timeout.
+     */
+    auto wait_for(std::chrono::nanoseconds timeout) noexcept -> bool;
+
+    /**
+     * @brief Gets the eventfd that becomes readable when the event is signaled.
+     * 
+     * @return The file descriptor, -1 on platforms without eventfd.
+     */
+    inline auto get_handle() const noexcept -> int32_t { return _fd; }
+};
+} // namespace common::threading
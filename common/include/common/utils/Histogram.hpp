@@ -0,0 +1,240 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/CommonHeader.hpp"
+
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+namespace common::utils
+{
+/**
+ * @brief Log-linear histogram of non-negative integer values, in the style of HdrHistogram.
+ *
+ * Every power of two range is split into SUB_BUCKET_COUNT equal buckets, so a recorded
+ * value is reported with a relative error below 1 / SUB_BUCKET_COUNT (6.25%). Values
+ * below 2 * SUB_BUCKET_COUNT are counted exactly and values above MAX_VALUE are counted
+ * as MAX_VALUE. The buckets live in a fixed array, recording never allocates.
+ */
+class Histogram
+{
+public :
+    static constexpr uint32_t SUB_BUCKET_BITS = 4;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+    static constexpr uint32_t MAX_VALUE_BITS = 41;
+    static constexpr uint64_t MAX_VALUE = (1ull << MAX_VALUE_BITS) - 1;   ///< About 36 minutes in nanoseconds
+    static constexpr size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+private :
+    std::array<uint64_t, BUCKET_COUNT> _buckets{};
+    uint64_t _count = 0;
+    uint64_t _sum = 0;
+
+public :
+    /**
+     * @brief Gets the bucket a value is counted in.
+     */
+    static constexpr auto index_of(uint64_t value) noexcept -> size_t
+    {
+        if(value > MAX_VALUE) { value = MAX_VALUE; }
+        const uint32_t msb = most_significant_bit(value | 1);
+        const uint32_t shift = msb > SUB_BUCKET_BITS ? msb - SUB_BUCKET_BITS : 0;
+        return static_cast<size_t>(shift * SUB_BUCKET_COUNT + (value >> shift));
+    }
+
+    /**
+     * @brief Gets the smallest value counted in a bucket.
+     */
+    static constexpr auto lower_bound(size_t index) noexcept -> uint64_t
+    {
+        const uint32_t shift = index < 2 * SUB_BUCKET_COUNT 
+                             ? 0 : static_cast<uint32_t>(index / SUB_BUCKET_COUNT - 1);
+        return static_cast<uint64_t>(index - shift * SUB_BUCKET_COUNT) << shift;
+    }
+
+    /**
+     * @brief Gets the largest value counted in a bucket.
+     */
+    static constexpr auto upper_bound(size_t index) noexcept -> uint64_t
+    {
+        return index + 1 < BUCKET_COUNT ? lower_bound(index + 1) - 1 : MAX_VALUE;
+    }
+
+public :
+    /**
+     * @brief Counts a value.
+     * 
+     * @param value The value to count.
+     * @param count How many times the value occurred.
+     */
+    inline auto record(uint64_t value, uint64_t count = 1) noexcept -> void
+    {
+        _buckets[index_of(value)] += count;
+        _count += count;
+        _sum += value * count;
+    }
+
+    /**
+     * @brief Adds the counts of another histogram.
+     */
+    inline auto merge(const Histogram& other) noexcept -> void
+    {
+        for(size_t i = 0; i < BUCKET_COUNT; ++i) { _buckets[i] += other._buckets[i]; }
+        _count += other._count;
+        _sum += other._sum;
+    }
+
+    /**
+     * @brief Clears all counts.
+     */
+    inline auto reset() noexcept -> void
+    {
+        _buckets.fill(0);
+        _count = 0;
+        _sum = 0;
+    }
+
+    /// @brief Gets the number of counted values.
+    inline auto count() const noexcept -> uint64_t { return _count; }
+
+    /// @brief Gets the number of values counted in a bucket.
+    inline auto bucket(size_t index) const noexcept -> uint64_t { return _buckets[index]; }
+
+    /// @brief Gets the exact mean of the counted values, 0 if empty.
+    inline auto mean() const noexcept -> double
+    {
+        return _count > 0 ? static_cast<double>(_sum) / static_cast<double>(_count) : 0.0;
+    }
+
+    /// @brief Gets the lower bound of the lowest non-empty bucket, 0 if empty.
+    inline auto min() const noexcept -> uint64_t
+    {
+        for(size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            if(_buckets[i] > 0) { return lower_bound(i); }
+        }
+        return 0;
+    }
+
+    /// @brief Gets the upper bound of the highest non-empty bucket, 0 if empty.
+    inline auto max() const noexcept -> uint64_t
+    {
+        for(size_t i = BUCKET_COUNT; i > 0; --i)
+        {
+            if(_buckets[i - 1] > 0) { return upper_bound(i - 1); }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Gets the value below or at which a given share of the values lie.
+     * 
+     * @param percentile The share in percent, from 0 to 100.
+     * @return The upper bound of the bucket holding that value, 0 if empty.
+     */
+    inline auto percentile(double percentile) const noexcept -> uint64_t
+    {
+        if(_count == 0) { return 0; }
+        if(percentile < 0.0) { percentile = 0.0; }
+        if(percentile > 100.0) { percentile = 100.0; }
+
+        auto rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(_count) + 0.5);
+        if(rank == 0) { rank = 1; }
+        uint64_t seen = 0;
+        for(size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += _buckets[i];
+            if(seen >= rank) { return upper_bound(i); }
+        }
+        return max();
+    }
+
+private :
+    static constexpr auto most_significant_bit(uint64_t value) noexcept -> uint32_t
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#else
+        uint32_t bit = 0;
+        while(value >>= 1) { ++bit; }
+        return bit;
+#endif
+    }
+
+    friend class AtomicHistogram;
+};
+
+/**
+ * @brief Histogram that one or more threads can record into while others read it.
+ *
+ * Every bucket is a relaxed atomic counter. Recording is wait-free and costs three
+ * uncontended atomic additions when every thread records into its own instance.
+ * snapshot() and reset() may run concurrently with record(); a snapshot taken during
+ * recording can miss the values that are being recorded at that moment.
+ */
+class AtomicHistogram
+{
+private :
+    std::array<std::atomic<uint64_t>, Histogram::BUCKET_COUNT> _buckets{};
+    std::atomic<uint64_t> _count{0};
+    std::atomic<uint64_t> _sum{0};
+
+public :
+    /**
+     * @brief Counts a value.
+     */
+    inline auto record(uint64_t value) noexcept -> void
+    {
+        _buckets[Histogram::index_of(value)].fetch_add(1, std::memory_order_relaxed);
+        _count.fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adds the current counts to a histogram.
+     */
+    inline auto snapshot(Histogram& histogram) const noexcept -> void
+    {
+        for(size_t i = 0; i < Histogram::BUCKET_COUNT; ++i)
+        {
+            histogram._buckets[i] += _buckets[i].load(std::memory_order_relaxed);
+        }
+        histogram._count += _count.load(std::memory_order_relaxed);
+        histogram._sum += _sum.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Clears all counts.
+     */
+    inline auto reset() noexcept -> void
+    {
+        for(auto& bucket : _buckets) { bucket.store(0, std::memory_order_relaxed); }
+        _count.store(0, std::memory_order_relaxed);
+        _sum.store(0, std::memory_order_relaxed);
+    }
+};
+} // namespace common::utils
@@ -26,6 +26,13 @@ SOFTWARE.
 
 #include "common/CommonHeader.hpp"
 #include <stdint.h>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 namespace common::utils
 {
@@ -39,4 +46,22 @@ namespace common::utils
  * @return uint32_t The next power of 2 greater than or equal to @p n.
  */
 COMMON_LIB_API auto next_pwr_of_2(uint32_t n) noexcept -> uint32_t;
+
+/**
+ * @brief Hints the processor that the caller is in a spin-wait loop.
+ *
+ * Emits @c pause on x86 and @c yield on ARM, which lowers power usage and frees
+ * pipeline resources for the sibling hyper-thread. Falls back to
+ * @c std::this_thread::yield() on other architectures.
+ */
+inline auto cpu_relax() noexcept -> void
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::this_thread::yield();
+#endif
+}
 } // namespace common::utils
\ No newline at end of file
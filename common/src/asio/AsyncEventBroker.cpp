@@ -33,8 +33,8 @@ namespace common::asio
 auto ClientSession::establish() -> void
 {
     auto self = shared_from_this();
-    _socket->receive([self](const Bytes& raw) {
-        self->onReceive(raw);
+    _socket->receive_buffer([self](memory::Buffer raw) {
+        self->onReceive(std::move(raw));
     }, [self]([[maybe_unused]] const auto& ec) {
         LogDebug << "client disconnected: " << ec;
         self->_onUnsubscribe(self);
@@ -48,11 +48,24 @@ auto ClientSession::send(const Bytes& bytesFrame) -> void
     });
 }
 
-auto ClientSession::onReceive(const Bytes& raw) -> void
+auto ClientSession::send(memory::Buffer bufferFrame) -> void
+{
+    _socket->send(std::move(bufferFrame), nullptr, [](const auto& ec) {
+        LogError << "broker send error: " << ec;
+    });
+}
+
+auto ClientSession::onReceive(memory::Buffer raw) -> void
 {
     using namespace common::communication;
 
-    auto frame = Frame::parse(raw);
+    if(raw.size() < Frame::HEADER_SIZE)
+    {
+        LogError << "frame too short: " << raw.size();
+        return;
+    }
+
+    auto frame = FrameView::parse(raw);
     switch(frame._type)
     {
     case Frame::REGIST:
@@ -62,7 +75,8 @@ auto ClientSession::onReceive(const Bytes& raw) -> void
         _onUnsubscribe(shared_from_this());
         break;
     case Frame::DATA:
-        _onEvent(frame._topic, frame.payload);
+        // A DATA frame goes out to the subscribers exactly as it came in
+        _onEvent(frame._topic, raw);
         break;
     default:
         LogError << "unknown frame type: " << static_cast<int>(frame._type);
@@ -99,15 +113,18 @@ auto TopicRegistry::route(uint16_t topic, const Bytes& payload) -> void
 {
     using namespace common::communication;
 
-    auto bytesFrame = Frame::make(topic, Frame::DATA, payload);
+    forward(topic, Frame::make(topic, Frame::DATA, memory::Buffer::copy_of(payload.data(), payload.size())));
+}
 
+auto TopicRegistry::forward(uint16_t topic, const memory::Buffer& frame) -> void
+{
     std::shared_lock scopedLock(_lock);
     auto it = _sessions.find(topic);
     if(it == _sessions.end()) { return; }
 
     for(auto& weak : it->second)
     {
-        if(auto session = weak.lock()) { session->send(bytesFrame); }
+        if(auto session = weak.lock()) { session->send(frame); }
     }
 }
 
@@ -141,8 +158,8 @@ auto AsyncEventBroker::onAccept(std::shared_ptr<AsyncTcpSocket> socket) -> void
         [registry = _registry](std::shared_ptr<ClientSession> session) {
             registry->unregist(session);
         },
-        [registry = _registry](uint16_t topic, const Bytes& payload) {
-            registry->route(topic, payload);
+        [registry = _registry](uint16_t topic, const memory::Buffer& frame) {
+            registry->forward(topic, frame);
         }
     );
     session->establish();
@@ -67,15 +67,18 @@ auto TcpTransport::publish(const Bytes& payload) -> void
 {
     using namespace common::communication;
 
+    // The only copy of the payload: the frame header and the length prefix are written in front of it
+    auto frame = Frame::make(_topic, Frame::DATA, memory::Buffer::copy_of(payload.data(), payload.size()));
+
     auto self = shared_from_this();
-    ::asio::post(_strand, [self, payload]() {
+    ::asio::post(_strand, [self, frame = std::move(frame)]() mutable {
         if(!self->_connected.load())
         { 
             LogDebug << "event is not connected";
             return; 
         }
 
-        self->_socket->send(Frame::make(self->_topic, Frame::DATA, payload), 
+        self->_socket->send(std::move(frame), 
                             nullptr, [](const auto& ec) {
             if (ec) { LogError << "send error: " << ec; }
         });
@@ -84,6 +87,14 @@ auto TcpTransport::publish(const Bytes& payload) -> void
 
 auto TcpTransport::subscribe(communication::onMessage onMessageHandler, 
                              communication::onSubscribed onSubscribedHandler) -> void
+{
+    subscribe_buffer([onMessage = std::move(onMessageHandler)](memory::Buffer payload) {
+        onMessage(Bytes(payload.begin(), payload.end()));
+    }, std::move(onSubscribedHandler));
+}
+
+auto TcpTransport::subscribe_buffer(communication::onBufferMessage onMessageHandler, 
+                                    communication::onSubscribed onSubscribedHandler) -> void
 {
     using namespace common::communication;
 
@@ -99,17 +110,24 @@ auto TcpTransport::subscribe(communication::onMessage onMessageHandler,
     _socket->connect([self, onMessage = std::move(onMessageHandler), onSubscribed = std::move(onSubscribedHandler)]() mutable {
         self->_connected.store(true);
         self->_socket->send(Frame::make(self->_topic, Frame::REGIST));
-        self->_socket->receive([onMessage = std::move(onMessage),
-                                onSubscribed = std::move(onSubscribed)]
-                                (const Bytes& raw) {
-            auto frame = Frame::parse(raw);
+        self->_socket->receive_buffer([onMessage = std::move(onMessage),
+                                       onSubscribed = std::move(onSubscribed)]
+                                       (memory::Buffer raw) {
+            if(raw.size() < Frame::HEADER_SIZE)
+            {
+                LogError << "frame too short: " << raw.size();
+                return;
+            }
+
+            auto frame = FrameView::parse(raw);
             switch(frame._type)
             {
                 case Frame::ACK: // Subscribed
-                    onSubscribed();
+                    if(onSubscribed) { onSubscribed(); }
                     break;
                 case Frame::DATA:
-                    onMessage(frame.payload);
+                    raw.consume(Frame::HEADER_SIZE);
+                    onMessage(std::move(raw));
                     break;
                 default:
                     LogError << "undefined message type received";
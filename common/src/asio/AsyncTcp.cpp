@@ -2,12 +2,16 @@
 #include "common/asio/IOContext.hpp"
 
 #include <asio/ip/tcp.hpp>
-#include <asio/read.hpp>
 #include <asio/write.hpp>
 #include <asio/connect.hpp>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
 
 namespace common::asio
 {
@@ -17,10 +21,50 @@ class AsyncSocketImpl final : public AsyncTcpSocket
                             , public std::enable_shared_from_this<AsyncSocketImpl>
 {
 private :
+    static constexpr size_t HEADER_SIZE = sizeof(uint32_t);
+    static constexpr size_t MIN_READ_SIZE = 4 * 1024;
+
+    using onChunk = std::function<void(const memory::Buffer& chunk, Span<const Span<const uint8_t>> messages)>;
+
+    /**
+     * @brief A message waiting in the outgoing queue
+     *
+     * The length prefix is written into the headroom of _data when possible (_prefixed),
+     * otherwise it is kept in _header and gathered in front of _data.
+     */
+    struct Outgoing
+    {
+        memory::Buffer _data;
+        std::array<uint8_t, HEADER_SIZE> _header{};
+        bool _prefixed = false;
+        onSend _onSend;
+        onError _onError;
+
+        inline auto bytes() const noexcept -> size_t { return _data.size() + (_prefixed ? 0 : HEADER_SIZE); }
+    };
+
     communication::Connection _conn;
     std::atomic<bool> _connected{false};
     ::asio::ip::tcp::socket _socket;
 
+    memory::Buffer _chunk;                          ///< Receive chunk, bytes from _chunkBegin to _chunkEnd are not delivered yet
+    size_t _chunkBegin = 0;
+    size_t _chunkEnd = 0;
+    std::vector<Span<const uint8_t>> _messages;
+
+    mutable std::mutex _writeLock;
+    std::deque<Outgoing> _pending;
+    bool _writing = false;                          ///< A write is in flight, only its owner touches _inflight
+    std::vector<Outgoing> _inflight;
+    std::vector<::asio::const_buffer> _gather;
+    std::atomic<size_t> _queuedBytes{0};
+    size_t _highWatermark = 0;
+    size_t _lowWatermark = 0;
+    bool _blocked = false;
+    onWritable _onWritable;
+    std::recursive_mutex _notifyLock;               ///< Serializes onWritable callbacks, a callback may send(). Taken before _writeLock
+    bool _reported = true;                          ///< Last state handed to _onWritable, guarded by _notifyLock
+
 public :
     AsyncSocketImpl(const communication::Connection& conn) noexcept
         : _conn(conn), _socket(IOContext::get_instance()->get_context()) {}
@@ -69,12 +113,109 @@ public :
 
     auto receive(onReceive onReceiveHandler, onError onErrorHandler /*= nullptr*/) -> void override
     {
-        auto header = std::make_shared<std::array<uint8_t, 4>>();
-        ::asio::async_read(_socket, ::asio::buffer(*header),
-                           [self = shared_from_this(), 
-                            header, 
-                            onReceive = std::move(onReceiveHandler), 
-                            onError = std::move(onErrorHandler)] (const auto& ec, std::size_t) mutable 
+        read_chunk([onReceive = std::move(onReceiveHandler), message = std::vector<uint8_t>()]
+                   ([[maybe_unused]] const memory::Buffer& chunk, Span<const Span<const uint8_t>> messages) mutable {
+            for(const auto& view : messages)
+            {
+                message.assign(view.begin(), view.end());
+                onReceive(message);
+            }
+        }, std::move(onErrorHandler));
+    }
+
+    auto receive_buffer(onReceiveBuffer onReceiveHandler, onError onErrorHandler /*= nullptr*/) -> void override
+    {
+        read_chunk([onReceive = std::move(onReceiveHandler)]
+                   (const memory::Buffer& chunk, Span<const Span<const uint8_t>> messages) {
+            for(const auto& view : messages)
+            {
+                onReceive(chunk.slice(static_cast<size_t>(view.data() - chunk.data()), view.size()));
+            }
+        }, std::move(onErrorHandler));
+    }
+
+    auto receive_batch(onReceiveBatch onReceiveHandler, onError onErrorHandler /*= nullptr*/) -> void override
+    {
+        read_chunk([onReceive = std::move(onReceiveHandler)]
+                   ([[maybe_unused]] const memory::Buffer& chunk, Span<const Span<const uint8_t>> messages) {
+            onReceive(messages);
+        }, std::move(onErrorHandler));
+    }
+
+    auto send(const std::vector<uint8_t>& data, onSend onSendHandler /*= nullptr*/, onError onErrorHandler /*= nullptr*/) -> void override
+    {
+        send(memory::Buffer::copy_of(data.data(), data.size(), HEADER_SIZE), std::move(onSendHandler), std::move(onErrorHandler));
+    }
+
+    auto send(memory::Buffer data, onSend onSendHandler /*= nullptr*/, onError onErrorHandler /*= nullptr*/) -> void override
+    {
+        Outgoing outgoing;
+        const uint32_t payloadSize = static_cast<uint32_t>(data.size());
+        outgoing._prefixed = data.headroom() >= HEADER_SIZE && data.use_count() == 1;
+        if(outgoing._prefixed) { std::memcpy(data.prepend(HEADER_SIZE), &payloadSize, sizeof(payloadSize)); }
+        else { std::memcpy(outgoing._header.data(), &payloadSize, sizeof(payloadSize)); }
+        outgoing._data = std::move(data);
+        outgoing._onSend = std::move(onSendHandler);
+        outgoing._onError = std::move(onErrorHandler);
+
+        const size_t bytes = outgoing.bytes();
+        bool start = false;
+        bool changed = false;
+        {
+            std::lock_guard<std::mutex> scopedLock(_writeLock);
+            _pending.push_back(std::move(outgoing));
+            const size_t queued = _queuedBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            if(_highWatermark != 0 && !_blocked && queued > _highWatermark)
+            {
+                _blocked = true;
+                changed = true;
+            }
+            start = !_writing;
+            _writing = true;
+        }
+
+        if(changed) { notify_writable(); }
+        if(start) { write_next(); }
+    }
+
+    auto set_watermarks(size_t highWatermark, size_t lowWatermark, onWritable onWritableHandler /*= nullptr*/) -> void override
+    {
+        // Same order as notify_writable(): _notifyLock before _writeLock
+        std::lock_guard<std::recursive_mutex> notifyLock(_notifyLock);
+        std::lock_guard<std::mutex> scopedLock(_writeLock);
+        _highWatermark = highWatermark;
+        _lowWatermark = std::min(lowWatermark, highWatermark);
+        _onWritable = std::move(onWritableHandler);
+        _blocked = _highWatermark != 0 && _queuedBytes.load(std::memory_order_relaxed) > _highWatermark;
+        _reported = !_blocked;
+    }
+
+    auto queued_bytes() const noexcept -> size_t override
+    {
+        return _queuedBytes.load(std::memory_order_relaxed);
+    }
+
+    auto writable() const noexcept -> bool override
+    {
+        std::lock_guard<std::mutex> scopedLock(_writeLock);
+        return !_blocked;
+    }
+
+private :
+    /**
+     * @brief Reads the next chunk of the stream and hands every complete message in it to @p onChunkHandler.
+     *
+     * Only one read is in flight at a time, so the _chunk members are not shared.
+     */
+    auto read_chunk(onChunk onChunkHandler, onError onErrorHandler) -> void
+    {
+        prepare_chunk();
+
+        const auto target = ::asio::buffer(_chunk.data() + _chunkEnd, _chunk.size() - _chunkEnd);
+        _socket.async_read_some(target, 
+                                [self = shared_from_this(), 
+                                 onChunk = std::move(onChunkHandler), 
+                                 onError = std::move(onErrorHandler)] (const auto& ec, std::size_t bytes) mutable 
             {
                 if(ec)
                 {
@@ -89,48 +230,163 @@ public :
                     return;
                 }
 
-                uint32_t payloadSize = 0;
-                std::memcpy(&payloadSize, header->data(), sizeof(payloadSize));
-
-                auto payload = std::make_shared<std::vector<uint8_t>>(payloadSize);
-                ::asio::async_read(self->_socket, ::asio::buffer(*payload),
-                                   [self, payload, onReceive, onError]
-                                   (const auto& ec, std::size_t) mutable {
-                    if(!ec)
-                    {
-                        onReceive(*payload);
-                        self->receive(std::move(onReceive), std::move(onError));
-                    }
-                    else
-                    {
-                        LogDebug << "Receive payload error: " << ec.message();
-                        if(onError) { onError(ErrorCode::RECEIVE_FAILURE); }
-                    }
-                });
+                self->_chunkEnd += bytes;
+                self->split_messages();
+                if(!self->_messages.empty())
+                {
+                    onChunk(self->_chunk, {self->_messages.data(), self->_messages.size()});
+                }
+                self->read_chunk(std::move(onChunk), std::move(onError));
             }
         );
     }
 
-    auto send(const std::vector<uint8_t>& data, onSend onSendHandler /*= nullptr*/, onError onErrorHandler /*= nullptr*/) -> void override
+    /**
+     * @brief Makes room behind the undelivered bytes for the rest of the pending message and a read.
+     *
+     * Delivered bytes may still be referred to by slices handed out by receive_buffer(); a shared
+     * chunk is therefore never overwritten, the undelivered bytes move to a new chunk instead.
+     */
+    auto prepare_chunk() -> void
     {
-        auto buffer = std::make_shared<std::vector<uint8_t>>(4 + data.size());
-        const uint32_t payloadSize = static_cast<uint32_t>(data.size());
-        std::memcpy(buffer->data(), &payloadSize, sizeof(payloadSize));
-        std::memcpy(buffer->data() + 4, data.data(), data.size());
+        const size_t pending = _chunkEnd - _chunkBegin;
+        size_t required = pending + MIN_READ_SIZE;
+        if(pending >= HEADER_SIZE)
+        {
+            uint32_t payloadSize = 0;
+            std::memcpy(&payloadSize, _chunk.data() + _chunkBegin, sizeof(payloadSize));
+            required = std::max(required, HEADER_SIZE + payloadSize);
+        }
+
+        const bool shared = _chunk.use_count() > 1;
+        if(!shared && required <= _chunk.size())
+        {
+            if(pending == 0 || _chunkBegin + required > _chunk.size())
+            {
+                std::memmove(_chunk.data(), _chunk.data() + _chunkBegin, pending);
+                _chunkBegin = 0;
+                _chunkEnd = pending;
+            }
+            return;
+        }
+        if(shared && _chunkBegin + required <= _chunk.size()) { return; }
+
+        auto chunk = memory::Buffer::allocate(std::max(RECEIVE_CHUNK_SIZE, required), 0);
+        if(pending > 0) { std::memcpy(chunk.data(), _chunk.data() + _chunkBegin, pending); }
+        _chunk = std::move(chunk);
+        _chunkBegin = 0;
+        _chunkEnd = pending;
+    }
+
+    /**
+     * @brief Collects the complete messages between _chunkBegin and _chunkEnd into _messages.
+     */
+    auto split_messages() -> void
+    {
+        _messages.clear();
+        const uint8_t* bytes = _chunk.data();
+        while(_chunkEnd - _chunkBegin >= HEADER_SIZE)
+        {
+            uint32_t payloadSize = 0;
+            std::memcpy(&payloadSize, bytes + _chunkBegin, sizeof(payloadSize));
+            if(_chunkEnd - _chunkBegin - HEADER_SIZE < payloadSize) { break; }
+
+            _messages.push_back({bytes + _chunkBegin + HEADER_SIZE, payloadSize});
+            _chunkBegin += HEADER_SIZE + payloadSize;
+        }
+    }
+
+    /**
+     * @brief Takes up to MAX_COALESCED_MESSAGES queued messages and writes them with one async_write.
+     *
+     * Only called by the owner of the _writing flag, so _inflight and _gather are not shared.
+     */
+    auto write_next() -> void
+    {
+        {
+            std::lock_guard<std::mutex> scopedLock(_writeLock);
+            if(_pending.empty())
+            {
+                _writing = false;
+                return;
+            }
 
-        ::asio::async_write(_socket, ::asio::buffer(*buffer),
-                            [buffer, onSend = std::move(onSendHandler), onError = std::move(onErrorHandler)]
-                            (const auto& ec, std::size_t bytes) {
+            const size_t count = std::min(_pending.size(), MAX_COALESCED_MESSAGES);
+            for(size_t i = 0; i < count; ++i)
+            {
+                _inflight.push_back(std::move(_pending.front()));
+                _pending.pop_front();
+            }
+        }
+
+        // _inflight is not touched until the write completes, the buffers may point into it
+        _gather.clear();
+        for(auto& outgoing : _inflight)
+        {
+            if(!outgoing._prefixed) { _gather.push_back(::asio::buffer(outgoing._header)); }
+            _gather.push_back(::asio::buffer(outgoing._data.data(), outgoing._data.size()));
+        }
+
+        ::asio::async_write(_socket, _gather, 
+                            [self = shared_from_this()](const auto& ec, [[maybe_unused]] std::size_t bytes) {
+            self->written(ec);
+        });
+    }
+
+    auto written(const ::asio::error_code& ec) -> void
+    {
+        if(ec) { LogDebug << "Send error: " << ec.message(); }
+
+        size_t bytes = 0;
+        for(auto& outgoing : _inflight)
+        {
+            bytes += outgoing.bytes();
             if(!ec)
             {
-                if(onSend) { onSend(bytes); }
+                if(outgoing._onSend) { outgoing._onSend(outgoing.bytes()); }
             }
             else
             {
-                LogDebug << "Send error: " << ec.message();
-                if(onError) { onError(ErrorCode::SEND_FAILURE); }
+                if(outgoing._onError) { outgoing._onError(ErrorCode::SEND_FAILURE); }
             }
-        });
+        }
+        _inflight.clear();
+
+        bool changed = false;
+        {
+            std::lock_guard<std::mutex> scopedLock(_writeLock);
+            const size_t queued = _queuedBytes.fetch_sub(bytes, std::memory_order_relaxed) - bytes;
+            if(_blocked && queued <= _lowWatermark)
+            {
+                _blocked = false;
+                changed = true;
+            }
+        }
+
+        if(changed) { notify_writable(); }
+        write_next();
+    }
+
+    /**
+     * @brief Reports the current writable state to _onWritable if it differs from the last report.
+     *
+     * send() and written() race to report their transitions; taking the state under
+     * _notifyLock instead of passing it in keeps the reports in order and makes the
+     * last one match the queue.
+     */
+    auto notify_writable() -> void
+    {
+        std::lock_guard<std::recursive_mutex> notifyLock(_notifyLock);
+        bool state = true;
+        onWritable handler;
+        {
+            std::lock_guard<std::mutex> scopedLock(_writeLock);
+            state = !_blocked;
+            handler = _onWritable;
+        }
+        if(state == _reported) { return; }
+        _reported = state;
+        if(handler) { handler(state); }
     }
 };
 
@@ -0,0 +1,220 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/memory/BlockPool.hpp"
+
+#include <array>
+#include <mutex>
+
+namespace common::memory
+{
+namespace detail
+{
+constexpr size_t CLASS_COUNT = 4;
+constexpr size_t BATCH_SIZE = 32;
+constexpr size_t MAX_CACHED = BATCH_SIZE * 2;
+
+struct FreeBlock
+{
+    FreeBlock* _next;
+};
+
+constexpr auto class_of(size_t size) noexcept -> size_t
+{
+    if(size <= 64) { return 0; }
+    if(size <= 128) { return 1; }
+    if(size <= 256) { return 2; }
+    return 3;
+}
+
+constexpr auto size_of(size_t index) noexcept -> size_t
+{
+    return static_cast<size_t>(64) << index;
+}
+
+/**
+ * @brief Free lists shared by all threads, exchanged with thread caches in batches.
+ */
+class CentralList
+{
+private :
+    std::mutex _lock;
+    std::array<FreeBlock*, CLASS_COUNT> _heads{};
+
+public :
+    /// @brief Detaches up to @p count blocks. Returns the chain and its length in @p taken.
+    auto take(size_t index, size_t count, size_t& taken) noexcept -> FreeBlock*
+    {
+        std::lock_guard<std::mutex> scopedLock(_lock);
+        FreeBlock* head = _heads[index];
+        FreeBlock* tail = nullptr;
+        taken = 0;
+        for(FreeBlock* it = head; it && taken < count; it = it->_next)
+        {
+            tail = it;
+            ++taken;
+        }
+        if(!tail) { return nullptr; }
+
+        _heads[index] = tail->_next;
+        tail->_next = nullptr;
+        return head;
+    }
+
+    /// @brief Attaches a null-terminated chain of blocks.
+    auto give(size_t index, FreeBlock* head) noexcept -> void
+    {
+        if(!head) { return; }
+
+        FreeBlock* tail = head;
+        while(tail->_next) { tail = tail->_next; }
+
+        std::lock_guard<std::mutex> scopedLock(_lock);
+        tail->_next = _heads[index];
+        _heads[index] = head;
+    }
+};
+
+// Intentionally leaked: thread caches may flush into it during process teardown.
+auto central() -> CentralList&
+{
+    static CentralList* instance = new CentralList;
+    return *instance;
+}
+
+/**
+ * @brief Per-thread free lists. Trivially destructible so it stays usable while the
+ *        thread (or the process) is being torn down.
+ */
+struct ThreadCache
+{
+    std::array<FreeBlock*, CLASS_COUNT> _heads;
+    std::array<size_t, CLASS_COUNT> _counts;
+    bool _retired;
+};
+
+thread_local ThreadCache cache{};
+
+/**
+ * @brief Returns the cached blocks of an exiting thread to the central list.
+ */
+struct CacheGuard
+{
+    ~CacheGuard()
+    {
+        for(size_t i = 0; i < CLASS_COUNT; ++i)
+        {
+            central().give(i, cache._heads[i]);
+            cache._heads[i] = nullptr;
+            cache._counts[i] = 0;
+        }
+        cache._retired = true;
+    }
+
+    auto arm() noexcept -> void {}
+};
+
+thread_local CacheGuard guard;
+
+auto refill(size_t index) -> void
+{
+    guard.arm();
+
+    size_t taken = 0;
+    FreeBlock* head = central().take(index, BATCH_SIZE, taken);
+    if(!head)
+    {
+        const size_t blockSize = size_of(index);
+        auto* slab = static_cast<uint8_t*>(::operator new(blockSize * BATCH_SIZE));
+        for(size_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + i * blockSize);
+            block->_next = head;
+            head = block;
+        }
+        taken = BATCH_SIZE;
+    }
+    cache._heads[index] = head;
+    cache._counts[index] = taken;
+}
+} // namespace detail
+
+auto BlockPool::allocate(size_t size) -> void*
+{
+    using namespace detail;
+
+    if(size > MAX_BLOCK_SIZE) { return ::operator new(size); }
+
+    const size_t index = class_of(size);
+    if(cache._retired)
+    {
+        size_t taken = 0;
+        if(FreeBlock* block = central().take(index, 1, taken)) { return block; }
+        return ::operator new(size_of(index));
+    }
+
+    if(!cache._heads[index]) { refill(index); }
+
+    FreeBlock* block = cache._heads[index];
+    cache._heads[index] = block->_next;
+    --cache._counts[index];
+    return block;
+}
+
+auto BlockPool::deallocate(void* ptr, size_t size) noexcept -> void
+{
+    using namespace detail;
+
+    if(!ptr) { return; }
+    if(size > MAX_BLOCK_SIZE)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    const size_t index = class_of(size);
+    auto* block = static_cast<FreeBlock*>(ptr);
+    if(cache._retired)
+    {
+        block->_next = nullptr;
+        central().give(index, block);
+        return;
+    }
+
+    // A thread that only releases blocks must still flush its cache when it exits
+    guard.arm();
+    block->_next = cache._heads[index];
+    cache._heads[index] = block;
+    if(++cache._counts[index] <= MAX_CACHED) { return; }
+
+    // Keep the most recently released (cache-hot) blocks and hand the rest back so that
+    // producer/consumer thread pairs keep circulating blocks through the central list
+    FreeBlock* tail = cache._heads[index];
+    for(size_t i = 1; i < BATCH_SIZE; ++i) { tail = tail->_next; }
+    FreeBlock* surplus = tail->_next;
+    tail->_next = nullptr;
+    cache._counts[index] = BATCH_SIZE;
+    central().give(index, surplus);
+}
+} // namespace common::memory
@@ -0,0 +1,206 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/memory/Buffer.hpp"
+#include "common/Exception.hpp"
+
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace common::memory
+{
+namespace detail
+{
+constexpr size_t MIN_BUFFER_SIZE = 1024;
+constexpr size_t BUFFER_CLASS_COUNT = 11;              // 1 KiB ... 1 MiB
+constexpr size_t MAX_FREE_BYTES_PER_CLASS = 4 * 1024 * 1024;
+constexpr uint32_t UNPOOLED = static_cast<uint32_t>(BUFFER_CLASS_COUNT);
+
+constexpr auto buffer_class_of(size_t capacity) noexcept -> uint32_t
+{
+    uint32_t index = 0;
+    for(size_t size = MIN_BUFFER_SIZE; size < capacity && index < UNPOOLED; size <<= 1) { ++index; }
+    return index;
+}
+
+constexpr auto buffer_size_of(uint32_t index) noexcept -> size_t
+{
+    return MIN_BUFFER_SIZE << index;
+}
+
+/**
+ * @brief Free blocks of each size class. A class keeps at most MAX_FREE_BYTES_PER_CLASS,
+ * blocks beyond that are freed.
+ */
+class BufferFreeList
+{
+private :
+    struct Class
+    {
+        std::mutex _lock;
+        std::vector<void*> _blocks;
+    };
+    std::array<Class, BUFFER_CLASS_COUNT> _classes;
+
+public :
+    auto take(uint32_t index) noexcept -> void*
+    {
+        auto& cls = _classes[index];
+        std::lock_guard<std::mutex> scopedLock(cls._lock);
+        if(cls._blocks.empty()) { return nullptr; }
+        void* block = cls._blocks.back();
+        cls._blocks.pop_back();
+        return block;
+    }
+
+    auto give(uint32_t index, void* block) noexcept -> bool
+    {
+        auto& cls = _classes[index];
+        std::lock_guard<std::mutex> scopedLock(cls._lock);
+        if((cls._blocks.size() + 1) * buffer_size_of(index) > MAX_FREE_BYTES_PER_CLASS) { return false; }
+        try { cls._blocks.push_back(block); }
+        catch(...) { return false; }
+        return true;
+    }
+};
+
+// Intentionally leaked: Buffers held by static objects may be released during process teardown.
+auto free_list() -> BufferFreeList&
+{
+    static BufferFreeList* instance = new BufferFreeList;
+    return *instance;
+}
+} // namespace detail
+
+Buffer::Buffer(const Buffer& other) noexcept
+    : _block(other._block), _offset(other._offset), _size(other._size)
+{
+    if(_block) { _block->_refs.fetch_add(1, std::memory_order_relaxed); }
+}
+
+Buffer::Buffer(Buffer&& other) noexcept
+    : _block(other._block), _offset(other._offset), _size(other._size)
+{
+    other._block = nullptr;
+    other._offset = 0;
+    other._size = 0;
+}
+
+Buffer::~Buffer() noexcept
+{
+    reset();
+}
+
+auto Buffer::operator=(const Buffer& other) noexcept -> Buffer&
+{
+    if(this == &other) { return *this; }
+    if(other._block) { other._block->_refs.fetch_add(1, std::memory_order_relaxed); }
+    reset();
+    _block = other._block;
+    _offset = other._offset;
+    _size = other._size;
+    return *this;
+}
+
+auto Buffer::operator=(Buffer&& other) noexcept -> Buffer&
+{
+    if(this == &other) { return *this; }
+    reset();
+    _block = other._block;
+    _offset = other._offset;
+    _size = other._size;
+    other._block = nullptr;
+    other._offset = 0;
+    other._size = 0;
+    return *this;
+}
+
+auto Buffer::allocate(size_t size, size_t headroom /*= DEFAULT_HEADROOM*/) -> Buffer
+{
+    using namespace detail;
+
+    const size_t required = headroom + size;
+    const uint32_t index = buffer_class_of(required);
+    const size_t capacity = index == UNPOOLED ? required : buffer_size_of(index);
+
+    void* memory = index == UNPOOLED ? nullptr : free_list().take(index);
+    if(!memory) { memory = ::operator new(sizeof(Block) + capacity); }
+
+    Buffer buffer;
+    buffer._block = new (memory) Block{{1}, index, capacity};
+    buffer._offset = headroom;
+    buffer._size = size;
+    return buffer;
+}
+
+auto Buffer::copy_of(const uint8_t* data, size_t size, size_t headroom /*= DEFAULT_HEADROOM*/) -> Buffer
+{
+    auto buffer = allocate(size, headroom);
+    if(size > 0) { std::memcpy(buffer.data(), data, size); }
+    return buffer;
+}
+
+auto Buffer::prepend(size_t size) -> uint8_t*
+{
+    if(size > _offset) { throw OutOfRangeException("not enough headroom"); }
+    if(use_count() > 1) { throw BadHandlingException("buffer is shared"); }
+    _offset -= size;
+    _size += size;
+    return data();
+}
+
+auto Buffer::consume(size_t size) -> void
+{
+    if(size > _size) { throw OutOfRangeException("buffer is too short"); }
+    _offset += size;
+    _size -= size;
+}
+
+auto Buffer::slice(size_t offset, size_t size) const -> Buffer
+{
+    if(offset > _size || size > _size - offset) { throw OutOfRangeException("slice is out of range"); }
+    Buffer buffer(*this);
+    buffer._offset += offset;
+    buffer._size = size;
+    return buffer;
+}
+
+auto Buffer::reset() noexcept -> void
+{
+    using namespace detail;
+
+    Block* block = _block;
+    _block = nullptr;
+    _offset = 0;
+    _size = 0;
+    if(!block || block->_refs.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
+
+    const uint32_t index = block->_class;
+    block->~Block();
+    if(index == UNPOOLED || !free_list().give(index, block)) { ::operator delete(block); }
+}
+} // namespace common::memory
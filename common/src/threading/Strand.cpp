@@ -0,0 +1,102 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/Strand.hpp"
+
+namespace common::threading
+{
+namespace
+{
+thread_local const Strand* t_current = nullptr;
+} // namespace
+
+Strand::Strand(std::shared_ptr<TaskExecutor> executor, TaskExecutor::Priority::type priority, size_t batch) noexcept
+    : _executor(std::move(executor))
+    , _priority(priority)
+    , _batch(batch == 0 ? 1 : batch)
+{
+}
+
+auto Strand::post(Task&& task) noexcept -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _tasks.push_back(std::move(task));
+        if(_scheduled) { return; }
+        _scheduled = true;
+    }
+    schedule();
+}
+
+auto Strand::running_in_this_thread() const noexcept -> bool
+{
+    return t_current == this;
+}
+
+auto Strand::pending() noexcept -> size_t
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _tasks.size();
+}
+
+auto Strand::schedule() noexcept -> void
+{
+    _executor->post([self = shared_from_this()]() { self->drain(); }, _priority);
+}
+
+auto Strand::drain() noexcept -> void
+{
+    const Strand* previous = std::exchange(t_current, this);
+    for(size_t i = 0; i < _batch; ++i)
+    {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if(_tasks.empty())
+            {
+                _scheduled = false;
+                t_current = previous;
+                return;
+            }
+            task = _tasks.pop_front();
+        }
+
+        try { task(); }
+        catch(...) {}
+    }
+    t_current = previous;
+
+    // The batch is used up, requeue behind the other strands. _scheduled stays set
+    // so that posts in the meantime do not schedule a second drain.
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(_tasks.empty())
+        {
+            _scheduled = false;
+            return;
+        }
+    }
+    schedule();
+}
+} // namespace common::threading
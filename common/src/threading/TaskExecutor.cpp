@@ -0,0 +1,835 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#include "common/threading/TaskExecutor.hpp"
+#include "common/memory/BlockPool.hpp"
+#include "common/threading/Topology.hpp"
+
+#include <algorithm>
+
+namespace common::threading
+{
+namespace detail
+{
+/// @brief Executor owning the current worker thread.
+thread_local TaskExecutor* currentExecutor = nullptr;
+
+/// @brief Index of the current worker thread inside currentExecutor.
+thread_local uint32_t currentIndex = 0;
+
+/// @brief Moves a task into a pooled node that can be stored in a LockFreeWorkQueue.
+auto make_node(Task&& task, int64_t enqueued) -> QueuedTask*
+{
+    void* block = memory::BlockPool::allocate(sizeof(QueuedTask));
+    return new (block) QueuedTask{std::move(task), enqueued};
+}
+
+auto release_node(QueuedTask* node) noexcept -> void
+{
+    node->~QueuedTask();
+    memory::BlockPool::deallocate(node, sizeof(QueuedTask));
+}
+
+auto now() noexcept -> int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace detail
+
+TaskExecutor::TaskExecutor(uint32_t threadCount, 
+                           Mode::type mode /* = Mode::LOCKED */,
+                           Placement::type placement /* = Placement::NONE */) noexcept
+    : _mode(mode)
+    , _threadCount(utils::next_pwr_of_2(threadCount))
+    , _placement(placement)
+    , _states(new WorkerState[_threadCount])
+    , _counters(new LaneCounters[(_threadCount + 1) * LANE_COUNT])
+    , _workerCounters(new WorkerCounters[_threadCount + 1])
+{
+    set_idle_policy(IdlePolicy{});
+    const auto affinities = place();
+    _running.store(true);
+    _workers.reserve(_threadCount);
+
+    if(_mode == Mode::LOCKED)
+    {
+        _queues.reserve(_threadCount);
+        for(uint32_t i = 0; i < _threadCount; ++i)
+        {
+            _queues.push_back(std::make_shared<WorkQueue>(Priority::COUNT));
+        }
+    }
+    else
+    {
+        _deques.reserve(_threadCount * Priority::COUNT);
+        for(uint32_t i = 0; i < _threadCount * Priority::COUNT; ++i)
+        {
+            _deques.push_back(std::make_unique<LockFreeWorkQueue<QueuedTask*>>());
+        }
+    }
+
+    for(uint32_t i = 0; i < _threadCount; ++i)
+    {
+        auto worker = Thread::create();
+        worker->set_affinity(affinities[i]);
+        auto future = worker->start([index = i, this]() {
+            if(_mode == Mode::LOCKED) { run_locked(index); }
+            else { run_lock_free(index); }
+        });
+        _workers.push_back({std::move(future), std::move(worker)});
+    }
+}
+
+TaskExecutor::~TaskExecutor() noexcept
+{
+    stop();
+
+    // Discard tasks that were never picked up by a worker
+    QueuedTask* task = nullptr;
+    for(auto& queue : _deques)
+    {
+        while(queue->pop(task)) { detail::release_node(task); }
+    }
+    for(auto& injector : _injector)
+    {
+        while(!injector.empty()) { detail::release_node(injector.pop_front()); }
+    }
+}
+
+auto TaskExecutor::stop() noexcept -> void
+{
+    if(!_running.load()) { return; }
+
+    _running.store(false);
+    {
+        std::lock_guard<std::mutex> lock(_elasticLock);
+        _elasticCv.notify_all();
+    }
+    // Parked helpers use the same condition variable as the workers of the lock-free mode
+    {
+        std::lock_guard<std::mutex> lock(_parkLock);
+        _parkCv.notify_all();
+    }
+    if(std::get<1>(_monitor)) { std::get<0>(_monitor).wait(); }
+    for(auto& helper : _helpers) { std::get<0>(helper).wait(); }
+    _helpers.clear();
+
+    const auto threadCount = _workers.size();
+    for(size_t i = 0; i < threadCount; ++i)
+    {
+        if(_mode == Mode::LOCKED) { _queues[i]->finalize(); }
+        std::get<0>(_workers[i]).wait();
+    }
+    _workers.clear();
+}
+
+auto TaskExecutor::place() -> std::vector<std::vector<uint32_t>>
+{
+    std::vector<std::vector<uint32_t>> affinities(_threadCount);
+    _nodes.assign(_threadCount, 0);
+
+    if(_placement != Placement::NONE)
+    {
+        // Spread the workers evenly over the CPUs, listed node by node
+        const auto nodes = get_numa_nodes();
+        std::vector<std::pair<uint32_t, size_t>> cpus;
+        for(size_t n = 0; n < nodes.size(); ++n)
+        {
+            for(auto cpu : nodes[n]._cpus) { cpus.push_back({cpu, n}); }
+        }
+
+        for(uint32_t i = 0; i < _threadCount; ++i)
+        {
+            const auto& [cpu, n] = cpus[static_cast<size_t>(i) * cpus.size() / _threadCount];
+            _nodes[i] = nodes[n]._id;
+            if(_placement == Placement::CORE) { affinities[i] = {cpu}; }
+            else { affinities[i] = nodes[n]._cpus; }
+        }
+    }
+
+    // Every worker steals from the workers of its own node first, in ring order
+    _victims.assign(_threadCount, {});
+    for(uint32_t i = 0; i < _threadCount; ++i)
+    {
+        auto& victims = _victims[i];
+        for(uint32_t j = 1; j < _threadCount; ++j)
+        {
+            const uint32_t victim = (i + j) & (_threadCount - 1);
+            if(_nodes[victim] == _nodes[i]) { victims.push_back(victim); }
+        }
+        for(uint32_t j = 1; j < _threadCount; ++j)
+        {
+            const uint32_t victim = (i + j) & (_threadCount - 1);
+            if(_nodes[victim] != _nodes[i]) { victims.push_back(victim); }
+        }
+    }
+    return affinities;
+}
+
+auto TaskExecutor::run_locked(uint32_t index) -> void
+{
+    detail::currentExecutor = this;
+    detail::currentIndex = index;
+
+    size_t lane = 0;
+    while(_running.load())
+    {
+        auto task = _queues[index]->try_pop(lane);
+        size_t attempts = 0;
+        for (; !task._task && attempts < _victims[index].size(); ++attempts) 
+        {
+            task = _queues[_victims[index][attempts]]->try_steal(lane);
+        }
+        count_steals(attempts, static_cast<bool>(task._task));
+
+        if (task._task) 
+        {
+            busy(index);
+            execute(task, lane);
+            continue;
+        }
+
+        if (!idle(index)) 
+        {
+            if (auto* counters = telemetry()) { counters->_parks.fetch_add(1, std::memory_order_relaxed); }
+            _queues[index]->wait(_running);
+        }
+    }
+
+    detail::currentExecutor = nullptr;
+}
+
+auto TaskExecutor::run_lock_free(uint32_t index) -> void
+{
+    detail::currentExecutor = this;
+    detail::currentIndex = index;
+
+    size_t lane = 0;
+    while(_running.load(std::memory_order_acquire))
+    {
+        if(QueuedTask* task = find_task(index, lane))
+        {
+            busy(index);
+            execute(*task, lane);
+            detail::release_node(task);
+            continue;
+        }
+
+        if(!idle(index)) 
+        {
+            if(auto* counters = telemetry()) { counters->_parks.fetch_add(1, std::memory_order_relaxed); }
+            park();
+        }
+    }
+
+    detail::currentExecutor = nullptr;
+}
+
+auto TaskExecutor::try_run_one() -> bool
+{
+    const bool isWorker = detail::currentExecutor == this;
+    const uint32_t start = isWorker ? detail::currentIndex : _index.load(std::memory_order_relaxed);
+    size_t lane = 0;
+
+    if(_mode == Mode::LOCKED)
+    {
+        const size_t count = _queues.size();
+        for(size_t i = 0; i < count; ++i)
+        {
+            auto task = _queues[(start + i) & (count - 1)]->try_steal(lane);
+            if(task._task)
+            {
+                count_steals(i + 1, true);
+                execute(task, lane);
+                return true;
+            }
+        }
+        count_steals(count, false);
+        return false;
+    }
+
+    QueuedTask* task = isWorker ? find_task(start, lane) : steal_task(start, lane);
+    if(!task) { return false; }
+    execute(*task, lane);
+    detail::release_node(task);
+    return true;
+}
+
+auto TaskExecutor::schedule(Task&& task, Priority::type priority, bool record /* = true */) noexcept -> void
+{
+    const int64_t enqueued = record ? timestamp() : 0;
+    if(_mode == Mode::LOCKED)
+    {
+        const uint32_t queueIndex = _index.fetch_add(1) & (_queues.size() - 1);
+        _queues[queueIndex]->push(std::move(task), priority, enqueued);
+        if(_sleepers.load() > 0) { signal(); }
+        return;
+    }
+
+    QueuedTask* node = detail::make_node(std::move(task), enqueued);
+    if(detail::currentExecutor == this)
+    {
+        deque(detail::currentIndex, priority).push(node);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(_injectorLock);
+        _injector[priority].push_back(std::move(node));
+        _injectorSize[priority].fetch_add(1, std::memory_order_release);
+    }
+    signal();
+}
+
+auto TaskExecutor::schedule_bulk(Task* tasks, size_t count, Priority::type priority) noexcept -> void
+{
+    if(count == 0) { return; }
+
+    const int64_t enqueued = timestamp();
+    if(_mode == Mode::LOCKED)
+    {
+        // Hand out one contiguous chunk per queue, continuing the round-robin sequence
+        const size_t queueCount = _queues.size();
+        const size_t used = std::min(count, queueCount);
+        const uint32_t start = _index.fetch_add(static_cast<uint32_t>(used));
+        const size_t chunk = count / used;
+        const size_t remainder = count % used;
+
+        size_t offset = 0;
+        for(size_t i = 0; i < used; ++i)
+        {
+            const size_t size = chunk + (i < remainder ? 1 : 0);
+            _queues[(start + i) & (queueCount - 1)]->push_bulk(tasks + offset, size, priority, enqueued);
+            offset += size;
+        }
+        if(_sleepers.load() > 0) { signal(count); }
+        return;
+    }
+
+    if(detail::currentExecutor == this)
+    {
+        auto& own = deque(detail::currentIndex, priority);
+        for(size_t i = 0; i < count; ++i) { own.push(detail::make_node(std::move(tasks[i]), enqueued)); }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(_injectorLock);
+        for(size_t i = 0; i < count; ++i)
+        {
+            _injector[priority].push_back(detail::make_node(std::move(tasks[i]), enqueued));
+        }
+        _injectorSize[priority].fetch_add(count, std::memory_order_release);
+    }
+    signal(count);
+}
+
+auto TaskExecutor::schedule_by(std::chrono::steady_clock::time_point deadline, Task&& task) noexcept -> void
+{
+    const auto later = [](const DeadlineTask& lhs, const DeadlineTask& rhs) { return lhs._deadline > rhs._deadline; };
+    {
+        std::lock_guard<std::mutex> lock(_deadlineLock);
+        _deadlines.push_back({std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count(),
+                              timestamp(),
+                              std::move(task)});
+        std::push_heap(_deadlines.begin(), _deadlines.end(), later);
+    }
+
+    // Every deadline task is paired with one trampoline that runs the earliest deadline task
+    schedule(Task([this]() { run_deadline(); }), Priority::REAL_TIME, false);
+}
+
+auto TaskExecutor::run_deadline() -> void
+{
+    const auto later = [](const DeadlineTask& lhs, const DeadlineTask& rhs) { return lhs._deadline > rhs._deadline; };
+    DeadlineTask task;
+    {
+        std::lock_guard<std::mutex> lock(_deadlineLock);
+        if(_deadlines.empty()) { return; }
+        std::pop_heap(_deadlines.begin(), _deadlines.end(), later);
+        task = std::move(_deadlines.back());
+        _deadlines.pop_back();
+    }
+
+    record(DEADLINE_LANE, task._enqueued, task._deadline);
+    task._task();
+}
+
+auto TaskExecutor::execute(QueuedTask& task, size_t lane) -> void
+{
+    record(lane, task._enqueued);
+    const bool elastic = _elastic.load(std::memory_order_relaxed) && detail::currentExecutor == this;
+    auto* counters = telemetry();
+    if(!elastic && !counters)
+    {
+        task._task();
+        return;
+    }
+
+    // Publish the start time so that the load monitor can tell a blocked worker
+    const int64_t start = detail::now();
+    std::atomic<int64_t>* started = elastic ? &_states[detail::currentIndex]._started : nullptr;
+    const int64_t outer = started ? started->exchange(start, std::memory_order_relaxed) : 0;
+    task._task();
+    if(started) { started->store(outer, std::memory_order_relaxed); }
+    if(counters)
+    {
+        counters->_tasks.fetch_add(1, std::memory_order_relaxed);
+        counters->_runTime.record(static_cast<uint64_t>(std::max<int64_t>(detail::now() - start, 0)));
+    }
+}
+
+auto TaskExecutor::record(size_t lane, int64_t enqueued, int64_t deadline /* = 0 */) noexcept -> void
+{
+    if(enqueued == 0) { return; }
+
+    const int64_t now = detail::now();
+    const auto delay = static_cast<uint64_t>(std::max<int64_t>(now - enqueued, 0));
+    if(_elastic.load(std::memory_order_relaxed))
+    {
+        uint64_t sample = _delaySample.load(std::memory_order_relaxed);
+        while(delay > sample && !_delaySample.compare_exchange_weak(sample, delay, std::memory_order_relaxed)) {}
+    }
+    if(auto* workerCounters = telemetry()) { workerCounters->_waitTime.record(delay); }
+    if(!_statistics.load(std::memory_order_relaxed)) { return; }
+
+    auto& counters = _counters[slot() * LANE_COUNT + lane];
+
+    counters._count.fetch_add(1, std::memory_order_relaxed);
+    counters._totalDelay.fetch_add(delay, std::memory_order_relaxed);
+    uint64_t max = counters._maxDelay.load(std::memory_order_relaxed);
+    while(delay > max && !counters._maxDelay.compare_exchange_weak(max, delay, std::memory_order_relaxed)) {}
+    if(deadline != 0 && now > deadline) { counters._missed.fetch_add(1, std::memory_order_relaxed); }
+}
+
+auto TaskExecutor::timestamp() const noexcept -> int64_t
+{
+    return _statistics.load(std::memory_order_relaxed) || 
+           _elastic.load(std::memory_order_relaxed) || 
+           _telemetry.load(std::memory_order_relaxed) ? detail::now() : 0;
+}
+
+auto TaskExecutor::slot() const noexcept -> uint32_t
+{
+    return detail::currentExecutor == this ? detail::currentIndex : _threadCount;
+}
+
+auto TaskExecutor::telemetry() noexcept -> WorkerCounters*
+{
+    return _telemetry.load(std::memory_order_relaxed) ? &_workerCounters[slot()] : nullptr;
+}
+
+auto TaskExecutor::count_steals(size_t attempts, bool stolen) noexcept -> void
+{
+    if(attempts == 0) { return; }
+    if(auto* counters = telemetry())
+    {
+        counters->_stealAttempts.fetch_add(attempts, std::memory_order_relaxed);
+        if(stolen) { counters->_steals.fetch_add(1, std::memory_order_relaxed); }
+    }
+}
+
+auto TaskExecutor::get_telemetry() const -> std::vector<WorkerTelemetry>
+{
+    std::vector<WorkerTelemetry> telemetry(_threadCount + 1);
+    for(uint32_t i = 0; i <= _threadCount; ++i)
+    {
+        const auto& counters = _workerCounters[i];
+        auto& worker = telemetry[i];
+        worker._tasks = counters._tasks.load(std::memory_order_relaxed);
+        worker._stealAttempts = counters._stealAttempts.load(std::memory_order_relaxed);
+        worker._steals = counters._steals.load(std::memory_order_relaxed);
+        worker._parks = counters._parks.load(std::memory_order_relaxed);
+        worker._idleTime = std::chrono::nanoseconds(counters._idleTime.load(std::memory_order_relaxed));
+        counters._waitTime.snapshot(worker._waitTime);
+        counters._runTime.snapshot(worker._runTime);
+
+        if(i == _threadCount)
+        {
+            for(const auto& size : _injectorSize) { worker._queueDepth += size.load(std::memory_order_relaxed); }
+        }
+        else if(_mode == Mode::LOCKED) { worker._queueDepth = _queues[i]->size(); }
+        else
+        {
+            for(size_t p = 0; p < Priority::COUNT; ++p) { worker._queueDepth += deque(i, p).size(); }
+        }
+    }
+    return telemetry;
+}
+
+auto TaskExecutor::reset_telemetry() noexcept -> void
+{
+    for(uint32_t i = 0; i <= _threadCount; ++i)
+    {
+        auto& counters = _workerCounters[i];
+        counters._tasks.store(0, std::memory_order_relaxed);
+        counters._stealAttempts.store(0, std::memory_order_relaxed);
+        counters._steals.store(0, std::memory_order_relaxed);
+        counters._parks.store(0, std::memory_order_relaxed);
+        counters._idleTime.store(0, std::memory_order_relaxed);
+        counters._waitTime.reset();
+        counters._runTime.reset();
+    }
+}
+
+auto TaskExecutor::collect(size_t lane) const noexcept -> QueueStatistics
+{
+    QueueStatistics statistics;
+    for(uint32_t slot = 0; slot <= _threadCount; ++slot)
+    {
+        const auto& counters = _counters[slot * LANE_COUNT + lane];
+        statistics._count += counters._count.load(std::memory_order_relaxed);
+        statistics._totalDelay += std::chrono::nanoseconds(counters._totalDelay.load(std::memory_order_relaxed));
+        statistics._maxDelay = std::max(statistics._maxDelay,
+                                        std::chrono::nanoseconds(counters._maxDelay.load(std::memory_order_relaxed)));
+        statistics._missedDeadlines += counters._missed.load(std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
+auto TaskExecutor::get_statistics(Priority::type priority) const noexcept -> QueueStatistics
+{
+    return collect(priority);
+}
+
+auto TaskExecutor::get_deadline_statistics() const noexcept -> QueueStatistics
+{
+    return collect(DEADLINE_LANE);
+}
+
+auto TaskExecutor::reset_statistics() noexcept -> void
+{
+    for(size_t i = 0; i < (_threadCount + 1) * LANE_COUNT; ++i)
+    {
+        _counters[i]._count.store(0, std::memory_order_relaxed);
+        _counters[i]._totalDelay.store(0, std::memory_order_relaxed);
+        _counters[i]._maxDelay.store(0, std::memory_order_relaxed);
+        _counters[i]._missed.store(0, std::memory_order_relaxed);
+    }
+}
+
+auto TaskExecutor::find_task(uint32_t index, size_t& lane) noexcept -> QueuedTask*
+{
+    QueuedTask* task = nullptr;
+    const size_t count = _threadCount;
+    for(lane = 0; lane < Priority::COUNT; ++lane)
+    {
+        auto& own = deque(index, lane);
+        if(own.pop(task)) { return task; }
+
+        if(_injectorSize[lane].load(std::memory_order_acquire) > 0)
+        {
+            size_t moved = 0;
+            {
+                std::lock_guard<std::mutex> lock(_injectorLock);
+                auto& injector = _injector[lane];
+                if(!injector.empty())
+                {
+                    // Take a fair share of the injection queue. The first task runs now,
+                    // the rest go to the own deque in reverse order so that the owner keeps
+                    // FIFO order while other workers can steal them lock-free.
+                    const size_t batch = std::min(injector.size(), injector.size() / count + 1);
+                    for(size_t i = batch - 1; i > 0; --i) { own.push(injector[i]); }
+                    task = injector.pop_front();
+                    for(size_t i = 1; i < batch; ++i) { injector.pop_front(); }
+                    _injectorSize[lane].fetch_sub(batch, std::memory_order_release);
+                    moved = batch - 1;
+                }
+            }
+            if(moved > 0) { signal(); }
+            if(task) { return task; }
+        }
+
+        size_t attempts = 0;
+        for(auto victim : _victims[index])
+        {
+            ++attempts;
+            if(deque(victim, lane).steal(task)) 
+            {
+                count_steals(attempts, true);
+                return task;
+            }
+        }
+        count_steals(attempts, false);
+    }
+    return nullptr;
+}
+
+auto TaskExecutor::steal_task(uint32_t start, size_t& lane) noexcept -> QueuedTask*
+{
+    QueuedTask* task = nullptr;
+    const size_t count = _threadCount;
+    for(lane = 0; lane < Priority::COUNT; ++lane)
+    {
+        if(_injectorSize[lane].load(std::memory_order_acquire) > 0)
+        {
+            std::lock_guard<std::mutex> lock(_injectorLock);
+            if(!_injector[lane].empty())
+            {
+                _injectorSize[lane].fetch_sub(1, std::memory_order_release);
+                return _injector[lane].pop_front();
+            }
+        }
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            if(deque(static_cast<uint32_t>((start + i) & (count - 1)), lane).steal(task)) 
+            {
+                count_steals(i + 1, true);
+                return task;
+            }
+        }
+        count_steals(count, false);
+    }
+    return nullptr;
+}
+
+auto TaskExecutor::has_task() const noexcept -> bool
+{
+    if(_mode == Mode::LOCKED) { return pending() > 0; }
+
+    for(const auto& size : _injectorSize)
+    {
+        if(size.load(std::memory_order_acquire) > 0) { return true; }
+    }
+    for(const auto& queue : _deques)
+    {
+        if(!queue->empty()) { return true; }
+    }
+    return false;
+}
+
+auto TaskExecutor::set_elasticity(const Elasticity& elasticity) -> void
+{
+    std::lock_guard<std::mutex> lock(_elasticLock);
+    _elasticity = elasticity;
+    _elastic.store(elasticity._maxThreads > _threadCount);
+    if(_elastic.load() && !std::get<1>(_monitor) && _running.load())
+    {
+        auto monitor = Thread::create();
+        auto future = monitor->start([this]() { run_monitor(); });
+        _monitor = {std::move(future), std::move(monitor)};
+    }
+    _elasticCv.notify_all();
+
+    // Parked helpers retire as soon as elasticity is turned off
+    if(!_elastic.load()) { signal(_sleepers.load()); }
+}
+
+auto TaskExecutor::get_elasticity() noexcept -> Elasticity
+{
+    std::lock_guard<std::mutex> lock(_elasticLock);
+    return _elasticity;
+}
+
+auto TaskExecutor::pending() const noexcept -> size_t
+{
+    size_t count = 0;
+    if(_mode == Mode::LOCKED)
+    {
+        for(const auto& queue : _queues) { count += queue->size(); }
+        return count;
+    }
+
+    for(const auto& size : _injectorSize) { count += size.load(std::memory_order_relaxed); }
+    for(const auto& queue : _deques) { count += queue->size(); }
+    return count;
+}
+
+auto TaskExecutor::run_monitor() -> void
+{
+    std::unique_lock<std::mutex> lock(_elasticLock);
+    while(_running.load())
+    {
+        if(!_elastic.load())
+        {
+            _elasticCv.wait(lock, [this]() { return _elastic.load() || !_running.load(); });
+            continue;
+        }
+
+        const Elasticity config = _elasticity;
+        _elasticCv.wait_for(lock, config._interval, [this]() { return !_running.load(); });
+        if(!_running.load() || !_elastic.load()) { continue; }
+
+        // Join the helpers that retired since the last sample
+        _helpers.erase(std::remove_if(_helpers.begin(), _helpers.end(), [](auto& helper) {
+            return std::get<0>(helper).wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }), _helpers.end());
+
+        const int64_t now = detail::now();
+        const int64_t blockedAfter = std::chrono::duration_cast<std::chrono::nanoseconds>(config._blockedAfter).count();
+        uint32_t blocked = 0;
+        for(uint32_t i = 0; i < _threadCount; ++i)
+        {
+            const int64_t started = _states[i]._started.load(std::memory_order_relaxed);
+            if(started != 0 && now - started > blockedAfter) { ++blocked; }
+        }
+
+        const size_t tasks = pending();
+        const auto delay = static_cast<int64_t>(_delaySample.exchange(0, std::memory_order_relaxed));
+        const uint32_t helpers = _helperCount.load();
+        const size_t runnable = _threadCount - blocked + helpers;
+        const bool overloaded = tasks > config._queueDepth * runnable ||
+                                delay > std::chrono::duration_cast<std::chrono::nanoseconds>(config._maxDelay).count();
+
+        // Replace blocked workers and grow by one helper per sample while overloaded
+        uint32_t wanted = helpers;
+        if(tasks > 0)
+        {
+            wanted = std::max(wanted, blocked);
+            if(overloaded) { wanted = std::max(wanted, helpers + 1); }
+        }
+        wanted = std::min(wanted, config._maxThreads - _threadCount);
+
+        for(uint32_t i = helpers; i < wanted; ++i)
+        {
+            _helperCount.fetch_add(1);
+            auto helper = Thread::create();
+            auto future = helper->start([this, timeout = config._idleTimeout]() { run_helper(timeout); });
+            _helpers.push_back({std::move(future), std::move(helper)});
+        }
+    }
+}
+
+auto TaskExecutor::run_helper(std::chrono::nanoseconds idleTimeout) -> void
+{
+    int64_t idleSince = 0;
+    while(_running.load())
+    {
+        if(try_run_one())
+        {
+            idleSince = 0;
+            continue;
+        }
+
+        const int64_t now = detail::now();
+        if(idleSince == 0) { idleSince = now; }
+        const int64_t remaining = idleTimeout.count() - (now - idleSince);
+        if(remaining <= 0 || !_elastic.load()) { break; }
+        park(std::chrono::nanoseconds(remaining));
+    }
+    _helperCount.fetch_sub(1);
+}
+
+auto TaskExecutor::set_idle_policy(const IdlePolicy& policy) noexcept -> void
+{
+    _idleSpin.store(std::max<int64_t>(policy._spin.count(), 0), std::memory_order_relaxed);
+    _idleYield.store(std::max<int64_t>(policy._yield.count(), 0), std::memory_order_relaxed);
+    _idleStrategy.store(policy._strategy, std::memory_order_relaxed);
+}
+
+auto TaskExecutor::get_idle_policy() const noexcept -> IdlePolicy
+{
+    IdlePolicy policy;
+    policy._strategy = static_cast<IdlePolicy::Strategy::type>(_idleStrategy.load(std::memory_order_relaxed));
+    policy._spin = std::chrono::nanoseconds(_idleSpin.load(std::memory_order_relaxed));
+    policy._yield = std::chrono::nanoseconds(_idleYield.load(std::memory_order_relaxed));
+    return policy;
+}
+
+auto TaskExecutor::idle(uint32_t index) noexcept -> bool
+{
+    auto& state = _states[index];
+    const int64_t now = detail::now();
+    if(state._since == 0) { state._since = now; }
+    const int64_t elapsed = now - state._since;
+
+    const auto strategy = _idleStrategy.load(std::memory_order_relaxed);
+    int64_t spin = _idleSpin.load(std::memory_order_relaxed);
+    int64_t yield = _idleYield.load(std::memory_order_relaxed);
+    switch(strategy)
+    {
+    case IdlePolicy::Strategy::PARK :
+        return false;
+
+    case IdlePolicy::Strategy::BUSY_POLL :
+        if(elapsed < spin) { utils::cpu_relax(); }
+        else { std::this_thread::yield(); }
+        return true;
+
+    case IdlePolicy::Strategy::ADAPTIVE :
+        if(state._gap > 0)
+        {
+            // Waiting pays off only if the next task is expected within the budget
+            const int64_t expected = 2 * state._gap;
+            if(expected > spin + yield) { return false; }
+            spin = std::min(spin, expected);
+            yield = std::min(yield, expected - spin);
+        }
+        break;
+
+    default :
+        break;
+    }
+
+    if(elapsed < spin) { utils::cpu_relax(); }
+    else if(elapsed < spin + yield) { std::this_thread::yield(); }
+    else { return false; }
+    return true;
+}
+
+auto TaskExecutor::busy(uint32_t index) noexcept -> void
+{
+    auto& state = _states[index];
+    if(state._since == 0) { return; }
+
+    // Exponential moving average with a weight of 1/8 for the newest sample
+    const int64_t gap = detail::now() - state._since;
+    state._gap = state._gap == 0 ? gap : state._gap + (gap - state._gap) / 8;
+    state._since = 0;
+    if(auto* counters = telemetry()) 
+    {
+        counters->_idleTime.fetch_add(static_cast<uint64_t>(std::max<int64_t>(gap, 0)), std::memory_order_relaxed);
+    }
+}
+
+auto TaskExecutor::park(std::chrono::nanoseconds timeout /* = std::chrono::nanoseconds::max() */) noexcept -> void
+{
+    // The epoch is read before the final emptiness check, so a task scheduled after
+    // that check always changes the epoch and either prevents or ends the wait.
+    const uint64_t epoch = _epoch.load();
+    _sleepers.fetch_add(1);
+    if(!has_task())
+    {
+        const auto woken = [this, epoch]() { return _epoch.load() != epoch || !_running.load(); };
+        std::unique_lock<std::mutex> lock(_parkLock);
+        if(timeout == std::chrono::nanoseconds::max()) { _parkCv.wait(lock, woken); }
+        else { _parkCv.wait_for(lock, timeout, woken); }
+    }
+    _sleepers.fetch_sub(1);
+}
+
+auto TaskExecutor::signal(size_t count /* = 1 */) noexcept -> void
+{
+    _epoch.fetch_add(1);
+    const uint32_t sleepers = _sleepers.load();
+    if(sleepers > 0)
+    {
+        { std::lock_guard<std::mutex> lock(_parkLock); }
+        if(count >= sleepers) { _parkCv.notify_all(); }
+        else
+        {
+            for(size_t i = 0; i < count; ++i) { _parkCv.notify_one(); }
+        }
+    }
+}
+} // namespace common::threading
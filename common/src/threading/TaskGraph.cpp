@@ -0,0 +1,142 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/TaskGraph.hpp"
+
+#include <atomic>
+#include <mutex>
+
+namespace common::threading
+{
+struct TaskGraph::Execution
+{
+    TaskExecutor& _executor;
+    std::vector<Vertex> _nodes;
+    std::unique_ptr<std::atomic<uint32_t>[]> _pending;
+    std::atomic<size_t> _remaining;
+    std::atomic<bool> _failed{false};
+    std::exception_ptr _exception;
+    std::mutex _exceptionLock;
+    Promise<void> _promise;
+
+    Execution(TaskExecutor& executor, const std::vector<Vertex>& nodes)
+        : _executor(executor)
+        , _nodes(nodes)
+        , _pending(new std::atomic<uint32_t>[nodes.size()])
+        , _remaining(nodes.size())
+        , _promise(&executor)
+    {
+        for(size_t i = 0; i < _nodes.size(); ++i) { _pending[i].store(_nodes[i]._predecessors); }
+    }
+};
+
+auto TaskGraph::precede(Node before, Node after) -> void
+{
+    if(before >= _nodes.size() || after >= _nodes.size())
+    {
+        throw OutOfRangeException("task graph node");
+    }
+
+    _nodes[before]._successors.push_back(after);
+    ++_nodes[after]._predecessors;
+}
+
+auto TaskGraph::run(TaskExecutor& executor) const -> Future<void>
+{
+    // Kahn's algorithm, a graph with a cycle would never complete
+    std::vector<uint32_t> pending(_nodes.size());
+    std::vector<Node> ready;
+    for(Node i = 0; i < _nodes.size(); ++i)
+    {
+        pending[i] = _nodes[i]._predecessors;
+        if(pending[i] == 0) { ready.push_back(i); }
+    }
+    const std::vector<Node> roots = ready;
+    size_t visited = 0;
+    while(!ready.empty())
+    {
+        const Node node = ready.back();
+        ready.pop_back();
+        ++visited;
+        for(auto successor : _nodes[node]._successors)
+        {
+            if(--pending[successor] == 0) { ready.push_back(successor); }
+        }
+    }
+    if(visited != _nodes.size()) { throw BadHandlingException("cyclic task graph"); }
+
+    auto execution = std::make_shared<Execution>(executor, _nodes);
+    auto future = execution->_promise.get_future();
+    if(_nodes.empty())
+    {
+        execution->_promise.set_value();
+        return future;
+    }
+
+    for(auto root : roots)
+    {
+        executor.post(Task([execution, root]() { execute(execution, root); }));
+    }
+    return future;
+}
+
+auto TaskGraph::execute(const std::shared_ptr<Execution>& execution, Node node) noexcept -> void
+{
+    constexpr Node none = static_cast<Node>(-1);
+
+    while(node != none)
+    {
+        auto& vertex = execution->_nodes[node];
+        if(!execution->_failed.load(std::memory_order_acquire))
+        {
+            try { vertex._task(); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(execution->_exceptionLock);
+                if(!execution->_exception) { execution->_exception = std::current_exception(); }
+                execution->_failed.store(true, std::memory_order_release);
+            }
+        }
+
+        // Continue with the first ready successor on this thread, post the others
+        Node next = none;
+        for(auto successor : vertex._successors)
+        {
+            if(execution->_pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) { continue; }
+            if(next == none) { next = successor; }
+            else
+            {
+                execution->_executor.post(Task([execution, successor]() { execute(execution, successor); }));
+            }
+        }
+
+        if(execution->_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            if(execution->_exception) { execution->_promise.set_exception(execution->_exception); }
+            else { execution->_promise.set_value(); }
+        }
+        node = next;
+    }
+}
+} // namespace common::threading
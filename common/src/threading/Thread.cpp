@@ -23,17 +23,33 @@ SOFTWARE.
 **********************************************************************/
 
 #include "common/threading/Thread.hpp"
+#include "common/threading/Topology.hpp"
 #include "common/lifecycle/Application.h"
 #include "common/lifecycle/Resource.hpp"
 #include "common/Logger.hpp"
 #include "common/Exception.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <thread>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <vector>
 
-#if defined(LINUX)
+#if defined(WIN32)
+#include <malloc.h>
+#elif defined(LINUX)
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/syscall.h>
 #endif
 
@@ -41,12 +57,156 @@ namespace common::threading
 {
 namespace detail
 {
+/**
+ * @brief Stack size of the calling thread, 0 if unknown.
+ */
+auto current_stack_size() noexcept -> size_t
+{
+#if defined(LINUX)
+    pthread_attr_t attr;
+    if(0 != pthread_getattr_np(pthread_self(), &attr)) return 0;
+    size_t size = 0;
+    pthread_attr_getstacksize(&attr, &size);
+    pthread_attr_destroy(&attr);
+    return size;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Touches the next bytes of the calling thread's stack, so that they are mapped
+ * before the thread needs them. Must not be inlined, the frame is released on return.
+ */
+#if defined(WIN32)
+__declspec(noinline)
+#else
+__attribute__((noinline))
+#endif
+auto prefault_stack(size_t bytes) noexcept -> void
+{
+    static constexpr size_t PAGE = 4096;
+#if defined(WIN32)
+    auto stack = static_cast<volatile uint8_t*>(_alloca(bytes));
+#else
+    auto stack = static_cast<volatile uint8_t*>(alloca(bytes));
+#endif
+    for(size_t offset = 0; offset < bytes; offset += PAGE) stack[offset] = 0;
+}
+
+/**
+ * @brief Hands out the isolated CPUs one after another, so that threads asking for an
+ * isolated core are spread over all of them.
+ */
+auto next_isolated_cpu(uint32_t& cpu) -> bool
+{
+    static const std::vector<uint32_t> isolated = get_isolated_cpus();
+    static std::atomic<size_t> next{0};
+    if(isolated.empty()) return false;
+    cpu = isolated[next.fetch_add(1, std::memory_order_relaxed) % isolated.size()];
+    return true;
+}
+
+/**
+ * @brief std::thread look-alike that can be given a stack size of its own.
+ *
+ * std::thread takes no attributes, so on Linux the thread is started with pthread_create
+ * and attributes that apply to this thread only. Like std::thread it must be joined or
+ * detached before it is destroyed.
+ */
+class NativeThread final : public NonCopyable
+{
+private :
+#if defined(WIN32)
+    std::thread _thread;
+#elif defined(LINUX)
+    pthread_t _handle{};
+    bool _joinable = false;
+#endif
+
+public :
+    /**
+     * @param body Callable run by the thread, may be move-only
+     * @param stackSize Stack size in bytes, 0 keeps the system default. Ignored on Windows.
+     * @throws std::system_error If the thread cannot be started.
+     */
+    template <typename Body>
+    NativeThread(Body&& body, [[maybe_unused]] size_t stackSize)
+    {
+#if defined(WIN32)
+        _thread = std::thread(std::forward<Body>(body));
+#elif defined(LINUX)
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        if(stackSize > 0)
+        {
+            const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            const size_t size = std::max<size_t>((stackSize + page - 1) / page * page, PTHREAD_STACK_MIN);
+            pthread_attr_setstacksize(&attr, size);
+        }
+
+        auto start = std::make_unique<std::decay_t<Body>>(std::forward<Body>(body));
+        const int32_t result = pthread_create(&_handle, &attr, &NativeThread::run<std::decay_t<Body>>, start.get());
+        pthread_attr_destroy(&attr);
+        if(0 != result) { throw std::system_error(result, std::generic_category(), "pthread_create"); }
+        start.release();
+        _joinable = true;
+#endif
+    }
+
+    ~NativeThread() noexcept
+    {
+        if(joinable()) { std::terminate(); }
+    }
+
+public :
+#if defined(WIN32)
+    inline auto joinable() const noexcept -> bool { return _thread.joinable(); }
+    inline auto join() -> void { _thread.join(); }
+    inline auto detach() -> void { _thread.detach(); }
+    inline auto native_handle() -> HANDLE { return _thread.native_handle(); }
+#elif defined(LINUX)
+    inline auto joinable() const noexcept -> bool { return _joinable; }
+    inline auto native_handle() const noexcept -> pthread_t { return _handle; }
+
+    auto join() -> void
+    {
+        const int32_t result = pthread_join(_handle, nullptr);
+        if(0 != result) { throw std::system_error(result, std::generic_category(), "pthread_join"); }
+        _joinable = false;
+    }
+
+    auto detach() -> void
+    {
+        const int32_t result = pthread_detach(_handle);
+        if(0 != result) { throw std::system_error(result, std::generic_category(), "pthread_detach"); }
+        _joinable = false;
+    }
+
+private :
+    // An exception escaping the thread function terminates the process, as with std::thread
+    template <typename Body>
+    static auto run(void* arg) noexcept -> void*
+    {
+        std::unique_ptr<Body> body(static_cast<Body*>(arg));
+        (*body)();
+        return nullptr;
+    }
+#endif
+};
+
 class ThreadDetail final : public Thread
                          , public std::enable_shared_from_this<ThreadDetail>
 {
 private :
-    std::shared_ptr<std::thread> _thread;
-    std::shared_ptr<std::promise<void>> _promise;
+    std::optional<NativeThread> _thread;
+    std::promise<void> _promise;
+
+    // Handshake between start() and the new thread, kept here so that start() allocates no promises
+    std::mutex _startLock;
+    std::condition_variable _startCv;
+    bool _assigned = false;
+    bool _initialized = false;
 
 #if defined(WIN32)
     Priority _priority = Policies::DEFAULT;
@@ -54,6 +214,9 @@ private :
     Priority _priority = {Policies::DEFAULT, Level::DEFAULT};
 #endif
     std::string _name{lifecycle::get_app_name()};
+    std::vector<uint32_t> _affinity;
+    Config _config;
+    Report _report;
     uint64_t _tid = 0;
     std::atomic<bool> _started{false};
 
@@ -71,13 +234,32 @@ public :
 
         join();
 
-        _promise = std::make_shared<std::promise<void>>();
-        auto future = _promise->get_future();
-        auto initPromise = std::make_shared<std::promise<void>>();
-        auto initFuture = initPromise->get_future();
-        _thread = std::make_shared<std::thread>([this, 
-                                                 work = std::move(func), 
-                                                 ip = std::move(initPromise)]() {
+        _report = Report();
+        if(_config._isolatedCore)
+        {
+            uint32_t cpu = 0;
+            if(next_isolated_cpu(cpu))
+            {
+                _affinity = {cpu};
+                _report._isolatedCore = Outcome::APPLIED;
+            }
+            else
+            {
+                LogWarn << "[" << _name << "] no isolated cpu, keeping the configured affinity";
+                _report._isolatedCore = Outcome::FAILED;
+            }
+        }
+
+        _promise = std::promise<void>();
+        auto future = _promise.get_future();
+        _assigned = false;
+        _initialized = false;
+        auto body = [this, work = std::move(func)]() {
+            // set_priority() and set_name() use _thread, which is assigned only after the thread has started
+            {
+                std::unique_lock<std::mutex> lock(_startLock);
+                _startCv.wait(lock, [this]() { return _assigned; });
+            }
 #if (STRICT_MODE_ENABLED)
             lifecycle::Resource<Thread> resource;
             resource.track(shared_from_this());
@@ -88,17 +270,26 @@ public :
 #elif defined(LINUX)
             _tid = static_cast<uint64_t>(syscall(SYS_gettid));
 #endif
-            set_priority(_priority);
             set_name(_name);
-            ip->set_value();
+            apply_config();
+            {
+                std::lock_guard<std::mutex> lock(_startLock);
+                _initialized = true;
+                _startCv.notify_all();
+            }
             work();
             _started.store(false);
 #if (STRICT_MODE_ENABLED)
             resource.release();
 #endif
-            _promise->set_value();
-        });
-        initFuture.wait();
+            _promise.set_value();
+        };
+        _thread.emplace(std::move(body), _config._stackSize);
+
+        std::unique_lock<std::mutex> lock(_startLock);
+        _assigned = true;
+        _startCv.notify_all();
+        _startCv.wait(lock, [this]() { return _initialized; });
         return future;
     } 
 
@@ -149,9 +340,10 @@ public :
             pthread_t handle = _thread->native_handle();
             struct sched_param param;
             param.sched_priority = std::get<1>(priority);
-            if(0 != sched_setscheduler(handle, std::get<0>(priority), &param))
+            const int32_t result = pthread_setschedparam(handle, static_cast<int32_t>(std::get<0>(priority)), &param);
+            if(0 != result)
             {
-                LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] failed to set thread priority (" << errno << ")";
+                LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] failed to set thread priority (" << result << ")";
                 return false;
             }
         }
@@ -189,10 +381,258 @@ public :
         return _name;
     }
 
+    auto set_affinity(const std::vector<uint32_t>& cpus) -> bool override
+    {
+        if(_started.load() && !_thread->joinable())
+        {
+            LogError << "[" << std::hex << _tid << "][" << _name << "] can't set thread affinity";
+            throw BadHandlingException("invalid thread");
+        }
+        _affinity = cpus;
+        if(!_started.load() || _affinity.empty()) return true;
+        return apply_affinity();
+    }
+
+    auto get_affinity() const noexcept -> const std::vector<uint32_t>& override
+    {
+        return _affinity;
+    }
+
+    auto set_config(const Config& config) -> void override
+    {
+        if(_started.load())
+        {
+            LogError << "[" << std::hex << _tid << "][" << _name << "] can't configure a running thread";
+            throw AlreadyRunningException();
+        }
+        _config = config;
+#if defined(WIN32)
+        if(config._priority != Policies::DEFAULT) _priority = config._priority;
+#elif defined(LINUX)
+        if(std::get<0>(config._priority) != Policies::DEFAULT || std::get<1>(config._priority) != Level::DEFAULT) _priority = config._priority;
+#endif
+        if(!config._affinity.empty()) _affinity = config._affinity;
+    }
+
+    auto get_config() const noexcept -> const Config& override
+    {
+        return _config;
+    }
+
+    auto get_report() const noexcept -> Report override
+    {
+        return _report;
+    }
+
     auto get_tid() const noexcept -> uint64_t override
     {
         return _tid;
     }
+
+private :
+    /**
+     * @brief Applies the setup of the thread, runs on the new thread before the user function.
+     */
+    auto apply_config() -> void
+    {
+        if(_config._lockMemory)
+        {
+#if defined(LINUX)
+            if(0 == mlockall(MCL_CURRENT | MCL_FUTURE)) { _report._lockMemory = Outcome::APPLIED; }
+            else
+            {
+                LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] failed to lock memory (" << errno << ")";
+                _report._lockMemory = Outcome::FAILED;
+            }
+#else
+            LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] memory locking is not supported";
+            _report._lockMemory = Outcome::FAILED;
+#endif
+        }
+
+        if(!_affinity.empty())
+        {
+            _report._affinity = apply_affinity() ? Outcome::APPLIED : Outcome::FAILED;
+            if(_report._affinity == Outcome::APPLIED) _report._cpus = _affinity;
+        }
+
+#if defined(WIN32)
+        const bool priority = _priority != Policies::DEFAULT;
+#elif defined(LINUX)
+        const bool priority = std::get<0>(_priority) != Policies::DEFAULT || std::get<1>(_priority) != Level::DEFAULT;
+#endif
+        if(priority) { _report._priority = set_priority(_priority) ? Outcome::APPLIED : Outcome::FAILED; }
+
+        if(_config._stackSize > 0)
+        {
+            // The thread reports the stack size it actually got
+            const size_t stackSize = current_stack_size();
+            if(stackSize >= _config._stackSize) { _report._stackSize = Outcome::APPLIED; }
+            else
+            {
+                LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] stack size is " << stackSize << " instead of " << _config._stackSize;
+                _report._stackSize = Outcome::FAILED;
+            }
+        }
+
+        if(_config._prefaultStack > 0)
+        {
+            // Keep clear of the guard page, the frames below this one use some of the stack already
+            static constexpr size_t RESERVE = 64 * 1024;
+            size_t bytes = _config._prefaultStack;
+            const size_t stackSize = current_stack_size();
+            if(stackSize > 0) bytes = std::min(bytes, stackSize > RESERVE ? stackSize - RESERVE : 0);
+            if(bytes > 0) prefault_stack(bytes);
+            _report._prefaultStack = Outcome::APPLIED;
+        }
+    }
+
+    auto apply_affinity() -> bool
+    {
+#if defined(WIN32)
+        DWORD_PTR mask = 0;
+        for(auto cpu : _affinity)
+        {
+            if(cpu < sizeof(DWORD_PTR) * 8) mask |= static_cast<DWORD_PTR>(1) << cpu;
+        }
+        HANDLE handle = _thread->native_handle();
+        if(0 == SetThreadAffinityMask(handle, mask))
+        {
+            LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] failed to set thread affinity (" << GetLastError() << ")";
+            return false;
+        }
+#elif defined(LINUX)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for(auto cpu : _affinity)
+        {
+            if(cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        pthread_t handle = _thread->native_handle();
+        const int32_t result = pthread_setaffinity_np(handle, sizeof(set), &set);
+        if(0 != result)
+        {
+            LogWarn << "[" << std::hex << _tid << std::dec << "][" << _name << "] failed to set thread affinity (" << result << ")";
+            return false;
+        }
+#endif
+        return true;
+    }
+};
+
+/**
+ * @brief Parked threads serving Thread::async().
+ *
+ * A call is handed to a parked thread when there is one, otherwise a new thread is
+ * started, so calls never wait for each other. Once a call returns the thread parks
+ * again, unless enough threads are parked already or it stays unused for IDLE_TIMEOUT.
+ * Every call runs with the affinity and scheduling policy of the thread that submitted
+ * it and the name of the application, so it starts out like it would on a new thread.
+ */
+class AsyncPool final
+{
+private :
+    static constexpr auto IDLE_TIMEOUT = std::chrono::seconds(10);
+
+    /**
+     * @brief A call together with the setup a new thread would have inherited from its submitter
+     */
+    struct Job
+    {
+        std::function<void()> _work;
+#if defined(WIN32)
+        int32_t _priority = THREAD_PRIORITY_NORMAL;
+#elif defined(LINUX)
+        cpu_set_t _affinity;
+        int32_t _policy = SCHED_OTHER;
+        struct sched_param _param;
+#endif
+    };
+
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::deque<Job> _jobs;
+    size_t _idle = 0;
+    const size_t _maxIdle = std::max(2u, std::thread::hardware_concurrency());
+
+public :
+    /**
+     * @brief Never destroyed, parked threads may still wait on it while the process exits.
+     */
+    static auto get_instance() -> AsyncPool&
+    {
+        static AsyncPool* pool = new AsyncPool;
+        return *pool;
+    }
+
+    auto submit(std::function<void()>&& work) -> void
+    {
+        Job job;
+        job._work = std::move(work);
+#if defined(WIN32)
+        job._priority = GetThreadPriority(GetCurrentThread());
+#elif defined(LINUX)
+        CPU_ZERO(&job._affinity);
+        sched_getaffinity(0, sizeof(job._affinity), &job._affinity);
+        job._param.sched_priority = 0;
+        pthread_getschedparam(pthread_self(), &job._policy, &job._param);
+#endif
+
+        bool spawn = false;
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _jobs.push_back(std::move(job));
+            spawn = _jobs.size() > _idle;
+        }
+        if(spawn) { std::thread([this]() { park(); }).detach(); }
+        else { _cv.notify_one(); }
+    }
+
+private :
+    auto park() -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        while(true)
+        {
+            if(_jobs.empty())
+            {
+                if(_idle >= _maxIdle) { return; }
+                ++_idle;
+                const bool woken = _cv.wait_for(lock, IDLE_TIMEOUT, [this]() { return !_jobs.empty(); });
+                --_idle;
+                if(!woken) { return; }
+            }
+
+            auto job = std::move(_jobs.front());
+            _jobs.pop_front();
+            lock.unlock();
+            inherit(job);
+            job._work();
+            lock.lock();
+        }
+    }
+
+    /**
+     * @brief Gives the calling pool thread what a new thread started by the submitter would have.
+     *
+     * Failures are ignored: the pool thread may lack the privilege for a real-time policy that
+     * a new thread would simply have inherited, the call then runs with the policy it has.
+     */
+    auto inherit(const Job& job) -> void
+    {
+#if defined(WIN32)
+        HANDLE handle = GetCurrentThread();
+        std::string name = lifecycle::get_app_name();
+        std::wstring wideName(name.begin(), name.end());
+        SetThreadDescription(handle, wideName.c_str());
+        SetThreadPriority(handle, job._priority);
+#elif defined(LINUX)
+        pthread_t handle = pthread_self();
+        pthread_setname_np(handle, lifecycle::get_app_name().substr(0, 15).c_str());
+        pthread_setaffinity_np(handle, sizeof(job._affinity), &job._affinity);
+        pthread_setschedparam(handle, job._policy, &job._param);
+#endif
+    }
 };
 } // namespace detail
 
@@ -212,10 +652,15 @@ auto Thread::async(std::function<void()>&& func) noexcept -> std::future<void>
     auto promise = std::make_shared<std::promise<void>>();
     auto future = promise->get_future();
     
-    std::thread([promise, work = std::move(func)]() {
-        work();
+    detail::AsyncPool::get_instance().submit([promise, work = std::move(func)]() {
+        try { work(); }
+        catch(...)
+        {
+            promise->set_exception(std::current_exception());
+            return;
+        }
         promise->set_value();
-    }).detach();
+    });
     
     return future;
 }
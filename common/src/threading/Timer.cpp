@@ -23,98 +23,187 @@ SOFTWARE.
 **********************************************************************/
 
 #include "common/threading/Timer.hpp"
+#include "common/threading/TimerService.hpp"
 #include "common/threading/Thread.hpp"
+#include "common/threading/WaitEvent.hpp"
 #include "common/Exception.hpp"
 #include "common/Singleton.hpp"
 
 #include "common/Logger.hpp"
 
+#include <algorithm>
+#include <condition_variable>
 #include <thread>
 #include <exception>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <vector>
+
+#if defined(LINUX)
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#endif
 
 namespace common::threading
 {
 namespace detail
 {
+/**
+ * @brief Service shared by all timers. Callbacks run on a small executor so that a
+ * slow callback does not hold up the wheel.
+ */
+auto default_timer_service() -> std::shared_ptr<TimerService>
+{
+    static constexpr uint32_t CALLBACK_THREADS = 2;
+    static std::shared_ptr<TimerService> service = TimerService::create(TaskExecutor::create(CALLBACK_THREADS));
+    return service;
+}
+
+class TimerManager;
+
 class TimerDetail final : public Timer
                         , public std::enable_shared_from_this<TimerDetail>
 {
+    friend class TimerManager;
+
 private :
+    using Clock = std::chrono::steady_clock;
+
     Function _func;
     const Interval _interval;
-    const bool _async;
+    const Options _options;
+    std::shared_ptr<TimerService> _service;
     std::atomic<bool> _running{false};
-    std::shared_ptr<Thread> _thread;
-    std::future<void> _future;
-    std::condition_variable _cv;
+
     std::mutex _lock;
+    std::condition_variable _cv;
+    TimerService::Handle _handle;
+    std::shared_ptr<std::promise<void>> _promise;
+    bool _active = false;
+    std::thread::id _firing;
+    Clock::time_point _next;
+    Clock::time_point _counted;     // Latest missed deadline already counted as overrun
+
+    // Backend::PRECISE only
+    std::unique_ptr<WaitEvent> _wake;
+
+    std::atomic<uint64_t> _calls{0};
+    std::atomic<uint64_t> _overruns{0};
+    std::atomic<uint64_t> _skipped{0};
+    utils::AtomicHistogram _jitter;
+
+    // Owned by TimerManager
+    TimerDetail* _incoming = nullptr;
+    size_t _registryIndex = 0;
+    bool _registered = false;
 
 public :
     TimerDetail(Function&& func,
                 Interval interval,
-                bool async = false) noexcept;
+                Options options,
+                std::shared_ptr<TimerService> service) noexcept;
     ~TimerDetail() noexcept;
 
 public :
     auto start() -> std::future<void> override;
     auto stop() noexcept -> void override;
     auto status() noexcept -> bool override;
+    auto get_statistics() const noexcept -> Statistics override;
     auto wait_until_stop() -> void;
+
+private :
+    auto arm() -> void;
+    auto fire() -> void;
+    auto call() -> bool;
+    auto run_precise() -> void;
+    auto finish() -> void;
 };
 
+/**
+ * @brief Registry of the running timers, used to stop all of them at shutdown.
+ *
+ * A timer registers itself when it starts and unregisters when it finishes. Registration
+ * pushes the timer onto a lock-free stack. The stack is moved into the indexed registry
+ * the next time the lock is taken anyway, so removal is a swap with the last entry.
+ */
 class TimerManager : public Singleton<TimerManager>
 {
 private :
-    std::shared_mutex _lock;
-    std::vector<std::shared_ptr<TimerDetail>> _timers;
+    std::mutex _lock;
+    std::vector<TimerDetail*> _timers;
+    std::atomic<TimerDetail*> _incoming{nullptr};
     std::atomic<bool> _shutingdown{false};
 
 public :
-    auto regist(std::shared_ptr<TimerDetail> timer) -> void
+    auto regist(TimerDetail* timer) noexcept -> bool
     {
-        if(_shutingdown.load()) { return; }
+        if(_shutingdown.load()) { return false; }
 
-        std::lock_guard<std::shared_mutex> scopedLock(_lock);
-        _timers.push_back(timer);
+        timer->_incoming = _incoming.load(std::memory_order_relaxed);
+        while(!_incoming.compare_exchange_weak(timer->_incoming, timer, 
+                                               std::memory_order_release, 
+                                               std::memory_order_relaxed)) {}
+        return true;
     }
 
-    auto unregist(std::shared_ptr<TimerDetail> timer) -> void
+    auto unregist(TimerDetail* timer) -> void
     {
-        if (!_lock.try_lock()) { return; }
-        std::lock_guard<std::shared_mutex> scopedLock(_lock, std::adopt_lock);
-        _timers.erase(std::remove_if(_timers.begin(), _timers.end(),
-                                     [&](const std::shared_ptr<TimerDetail>& t) {
-                                        return t == timer || !t->status();
-        }), _timers.end());
+        std::lock_guard<std::mutex> scopedLock(_lock);
+        adopt_incoming();
+
+        const size_t index = timer->_registryIndex;
+        _timers[index] = _timers.back();
+        _timers[index]->_registryIndex = index;
+        _timers.pop_back();
     }
 
     auto force_stop_all() -> void
     {
         _shutingdown.store(true);
 
-        std::lock_guard<std::shared_mutex> scopedLock(_lock);
-        for(auto timer : _timers)
+        std::vector<std::shared_ptr<TimerDetail>> timers;
         {
-            timer->stop();
-            timer->wait_until_stop();
+            std::lock_guard<std::mutex> scopedLock(_lock);
+            adopt_incoming();
+            timers.reserve(_timers.size());
+            for(auto timer : _timers)
+            {
+                // A timer whose last owner is just letting go finishes on its own
+                if(auto alive = timer->weak_from_this().lock()) { timers.push_back(std::move(alive)); }
+            }
         }
 
-        _timers.clear();
+        // Finishing a timer unregisters it, so the lock must be released first. Stop all of
+        // them before waiting on any, so the wait is as long as the slowest one and not the sum.
+        for(auto& timer : timers) { timer->stop(); }
+        for(auto& timer : timers) { timer->wait_until_stop(); }
+    }
+
+private :
+    auto adopt_incoming() -> void
+    {
+        auto timer = _incoming.exchange(nullptr, std::memory_order_acquire);
+        while(timer != nullptr)
+        {
+            timer->_registryIndex = _timers.size();
+            _timers.push_back(timer);
+            timer = timer->_incoming;
+        }
     }
 };
 
 TimerDetail::TimerDetail(Function&& func,
                          Interval interval,
-                         bool async /* = false */) noexcept
-                         : _func(func), _interval(interval), _async(async) {}
+                         Options options,
+                         std::shared_ptr<TimerService> service) noexcept
+                         : _func(func), _interval(interval), _options(options), _service(std::move(service)) {}
 
 TimerDetail::~TimerDetail() noexcept
 {
+    // A scheduled expiry or the precise thread keeps the timer alive, so nothing can be pending here
     stop();
-    wait_until_stop();
-    if(_thread && !_async) { _thread->join(); };
 }
 
 auto TimerDetail::start() -> std::future<void>
@@ -122,38 +211,44 @@ auto TimerDetail::start() -> std::future<void>
     if(_running.load()) throw AlreadyRunningException(); 
     _running.store(true);
 
-    std::shared_ptr<std::promise<void>> timerPromise = std::make_shared<std::promise<void>>();
-    std::future<void> timerFuture = timerPromise->get_future();
-
-    _thread = Thread::create();
-    _future = _thread->start([this, timerPromise](){
-        {
-            std::unique_lock<std::mutex> lock(_lock);
-            _cv.wait_for(lock, _interval, [this]() {
-                return !_running.load();
-            });
-        }
-
-        while(_running.load())
-        {
-            if(false == _func()) { break; }
+    std::future<void> timerFuture;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _promise = std::make_shared<std::promise<void>>();
+        timerFuture = _promise->get_future();
+        _active = true;
+        _next = Clock::now() + _interval;
+        _counted = Clock::time_point::min();
+    }
+    _registered = detail::TimerManager::get_instance()->regist(this);
 
-            std::unique_lock<std::mutex> lock(_lock);
-            _cv.wait_for(lock, _interval, [this]() {
-                return !_running.load();
-            });
-        }
-        timerPromise->set_value();
-        detail::TimerManager::get_instance()->unregist(shared_from_this());
-    });
-    if(_async) { _thread->detach(); }
+    if(_options._backend == Backend::PRECISE)
+    {
+        _wake = std::make_unique<WaitEvent>();
+        // A dedicated thread keeps sub-millisecond periods off the shared wheel
+        Thread::async([self = shared_from_this()]() { self->run_precise(); });
+    }
+    else { arm(); }
     return timerFuture;
 }
 
 auto TimerDetail::stop() noexcept -> void
 { 
     _running.store(false);
-    _cv.notify_all();
+    if(_options._backend == Backend::PRECISE)
+    {
+        // The thread notices _running and finishes the timer itself
+        if(_wake) { _wake->notify(); }
+        return;
+    }
+
+    bool cancelled = false;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        cancelled = _service->cancel(_handle);
+    }
+    // Otherwise the expiry is already under way and finishes the timer itself
+    if(cancelled) { finish(); }
 }
 
 auto TimerDetail::status() noexcept -> bool
@@ -161,28 +256,179 @@ auto TimerDetail::status() noexcept -> bool
     return _running.load(); 
 }
 
+auto TimerDetail::get_statistics() const noexcept -> Statistics
+{
+    Statistics statistics;
+    statistics._calls = _calls.load(std::memory_order_relaxed);
+    statistics._overruns = _overruns.load(std::memory_order_relaxed);
+    statistics._skipped = _skipped.load(std::memory_order_relaxed);
+    _jitter.snapshot(statistics._jitter);
+    return statistics;
+}
+
 auto TimerDetail::wait_until_stop() -> void
 { 
-    if(_future.valid()) { _future.wait(); }
+    std::unique_lock<std::mutex> lock(_lock);
+    if(_firing == std::this_thread::get_id()) { return; }
+    _cv.wait(lock, [this]() { return !_active; });
+}
+
+auto TimerDetail::arm() -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(_running.load())
+        {
+            _handle = _service->schedule_at(_next, [self = shared_from_this()]() { self->fire(); });
+            if(_handle) { return; }
+        }
+    }
+    _running.store(false);
+    finish();
+}
+
+auto TimerDetail::fire() -> void
+{
+    if(_running.load() && call()) { arm(); }
+    else
+    {
+        _running.store(false);
+        finish();
+    }
+}
+
+auto TimerDetail::call() -> bool
+{
+    const auto started = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _firing = std::this_thread::get_id();
+    }
+    _jitter.record(static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(started - _next).count())));
+    _calls.fetch_add(1, std::memory_order_relaxed);
+
+    bool again = false;
+    try { again = _func(); }
+    catch(const std::exception& e) { LogError << "timer callback failed: " << e.what(); }
+    catch(...) { LogError << "timer callback failed"; }
+
+    const auto finished = Clock::now();
+    std::lock_guard<std::mutex> lock(_lock);
+    _firing = std::thread::id();
+    if(_options._schedule == Schedule::FIXED_DELAY)
+    {
+        _next = finished + _interval;
+        return again;
+    }
+
+    _next += _interval;
+    if(finished >= _next)
+    {
+        const auto missed = (finished - _next) / _interval + 1;
+
+        // While catching up _next stays behind, only deadlines passed since the last call are new overruns
+        const auto latest = _next + _interval * (missed - 1);
+        const auto overruns = _counted < _next ? missed : (latest - _counted) / _interval;
+        _overruns.fetch_add(static_cast<uint64_t>(overruns), std::memory_order_relaxed);
+        _counted = std::max(_counted, latest);
+        if(_options._overrun == Overrun::SKIP)
+        {
+            // Keep the phase of the schedule, only drop the deadlines that are already over
+            _next += _interval * missed;
+            _skipped.fetch_add(static_cast<uint64_t>(missed), std::memory_order_relaxed);
+        }
+    }
+    return again;
+}
+
+auto TimerDetail::run_precise() -> void
+{
+#if defined(LINUX)
+    const int32_t fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if(fd < 0) { LogError << "timerfd_create failed"; }
+    while(fd >= 0 && _running.load())
+    {
+        // steady_clock is CLOCK_MONOTONIC, so its time points are absolute timerfd deadlines
+        const auto deadline = std::chrono::duration_cast<std::chrono::nanoseconds>(_next.time_since_epoch()).count();
+        itimerspec spec{};
+        spec.it_value.tv_sec = static_cast<time_t>(deadline / 1000000000);
+        spec.it_value.tv_nsec = static_cast<long>(deadline % 1000000000);
+        if(spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) { spec.it_value.tv_nsec = 1; }
+        timerfd_settime(fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+
+        pollfd descriptors[2] = {{fd, POLLIN, 0}, {_wake->get_handle(), POLLIN, 0}};
+        if(poll(descriptors, 2, -1) <= 0 || (descriptors[0].revents & POLLIN) == 0) { continue; }
+
+        uint64_t expirations = 0;
+        [[maybe_unused]] const auto bytes = read(fd, &expirations, sizeof(expirations));
+        if(!_running.load() || !call()) { break; }
+    }
+    if(fd >= 0) { close(fd); }
+#else
+    while(_running.load())
+    {
+        const auto remaining = _next - Clock::now();
+        if(remaining > Clock::duration::zero())
+        {
+            _wake->wait_for(remaining);
+            continue;
+        }
+        if(!call()) { break; }
+    }
+#endif
+    _running.store(false);
+    finish();
+}
+
+auto TimerDetail::finish() -> void
+{
+    std::shared_ptr<std::promise<void>> promise;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(!_active) { return; }
+        _active = false;
+        promise = std::move(_promise);
+    }
+    if(_registered)
+    {
+        _registered = false;
+        detail::TimerManager::get_instance()->unregist(this);
+    }
+    _cv.notify_all();
+    promise->set_value();
 }
 } // namespace detail
 
 auto Timer::__create(Function&& func, Interval interval) noexcept -> std::unique_ptr<Timer, std::function<void(Timer*)>>
+{
+    return __create(std::forward<Function>(func), interval, Options());
+}
+
+auto Timer::__create(Function&& func, Interval interval, Options options) noexcept -> std::unique_ptr<Timer, std::function<void(Timer*)>>
 {
     auto sharedTimer = std::make_shared<detail::TimerDetail>(std::forward<Function>(func), 
-                                                             interval);
-    detail::TimerManager::get_instance()->regist(sharedTimer);
+                                                             interval,
+                                                             options,
+                                                             detail::default_timer_service());
     return std::unique_ptr<Timer, std::function<void(Timer*)>>(sharedTimer.get(), [sharedTimer](Timer*) mutable {
+        // Pending expiries hold a reference too, so stop the timer before letting go of it
+        sharedTimer->stop();
+        sharedTimer->wait_until_stop();
         sharedTimer.reset();
     });
 }
 
 auto Timer::async(Function&& func, Interval interval) noexcept -> std::future<void>
 {
-    auto sharedTimer = std::shared_ptr<detail::TimerDetail>(new detail::TimerDetail(std::forward<Function>(func), 
-                                                                                    interval,
-                                                                                    true));
-    detail::TimerManager::get_instance()->regist(sharedTimer);
+    return async(std::forward<Function>(func), interval, Options());
+}
+
+auto Timer::async(Function&& func, Interval interval, Options options) noexcept -> std::future<void>
+{
+    auto sharedTimer = std::make_shared<detail::TimerDetail>(std::forward<Function>(func), 
+                                                             interval,
+                                                             options,
+                                                             detail::default_timer_service());
     return sharedTimer->start();
 }
-} // namespace common::threading
\ No newline at end of file
+} // namespace common::threading
@@ -0,0 +1,320 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/TimerService.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace common::threading
+{
+namespace
+{
+inline auto rotate_right(uint64_t bits, size_t shift) noexcept -> uint64_t
+{
+    shift &= 63;
+    return shift == 0 ? bits : (bits >> shift) | (bits << (64 - shift));
+}
+
+inline auto lowest_bit(uint64_t bits) noexcept -> size_t
+{
+    return static_cast<size_t>(__builtin_ctzll(bits));
+}
+} // namespace
+
+TimerService::TimerService(Dispatcher dispatcher, std::chrono::nanoseconds tick) noexcept
+    : _dispatcher(std::move(dispatcher))
+    , _tick(tick.count() > 0 ? tick : std::chrono::nanoseconds(1))
+    , _start(Clock::now())
+{
+    for(auto& level : _slots) { level.fill(NONE); }
+
+    _thread = Thread::create();
+    _thread->set_name("timer-service");
+    _future = _thread->start([this]() { run(); });
+}
+
+TimerService::~TimerService() noexcept
+{
+    stop();
+}
+
+auto TimerService::schedule_at(Clock::time_point time, Task&& callback) noexcept -> Handle
+{
+    Handle handle;
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(!_running) { return handle; }
+
+        uint32_t index = _free;
+        if(index != NONE) { _free = _entries[index]._next; }
+        else
+        {
+            index = static_cast<uint32_t>(_entries.size());
+            _entries.emplace_back();
+        }
+
+        // Round up so that a timer never runs before its time
+        const auto offset = time - _start;
+        const uint64_t expiry = offset.count() <= 0 ? 0 : static_cast<uint64_t>((offset + _tick - Clock::duration(1)) / _tick);
+
+        Entry& entry = _entries[index];
+        entry._callback = std::move(callback);
+        entry._expiry = expiry;
+        entry._active = true;
+        insert(index);
+        ++_count;
+
+        handle._index = index;
+        handle._generation = entry._generation;
+        wake = expiry < _wakeTick;
+    }
+    if(wake) { _cv.notify_one(); }
+    return handle;
+}
+
+auto TimerService::cancel(Handle handle) noexcept -> bool
+{
+    Task callback;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(!handle || handle._index >= _entries.size()) { return false; }
+
+        Entry& entry = _entries[handle._index];
+        if(!entry._active || entry._generation != handle._generation) { return false; }
+
+        unlink(handle._index);
+        callback = std::move(entry._callback);
+        release(handle._index);
+    }
+    // The callback is destroyed outside the lock, it may own objects that use the service
+    return true;
+}
+
+auto TimerService::pending() const noexcept -> size_t
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _count;
+}
+
+auto TimerService::stop() noexcept -> void
+{
+    std::vector<Task> dropped;
+    bool self = false;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(!_running) { return; }
+        _running = false;
+        self = _threadId == std::this_thread::get_id();
+
+        for(auto& entry : _entries)
+        {
+            if(entry._active) { dropped.push_back(std::move(entry._callback)); }
+        }
+        _entries.clear();
+        _free = NONE;
+        for(auto& level : _slots) { level.fill(NONE); }
+        _occupied.fill(0);
+        _count = 0;
+    }
+    _cv.notify_one();
+
+    if(!self && _future.valid()) { _future.wait(); }
+}
+
+auto TimerService::run() -> void
+{
+    std::vector<Task> expired;
+    std::unique_lock<std::mutex> lock(_lock);
+    _threadId = std::this_thread::get_id();
+    while(_running)
+    {
+        const uint64_t now = to_tick(Clock::now());
+        while(_current <= now)
+        {
+            // With the lowest level empty no tick before the next cascade expires anything,
+            // so the empty ticks are skipped instead of walked one by one
+            if(_occupied[0] == 0)
+            {
+                const uint64_t next = next_tick();
+                if(next > now)
+                {
+                    _current = now + 1;
+                    break;
+                }
+                _current = next;
+            }
+
+            const size_t slot = _current & (SLOTS - 1);
+            if(slot == 0)
+            {
+                for(size_t level = 1; level < LEVELS; ++level)
+                {
+                    const size_t index = (_current >> (SLOT_BITS * level)) & (SLOTS - 1);
+                    cascade(level, index);
+                    if(index != 0) { break; }
+                }
+            }
+            expire(slot, expired);
+            ++_current;
+        }
+
+        if(!expired.empty())
+        {
+            lock.unlock();
+            for(auto& callback : expired)
+            {
+                if(_dispatcher) { _dispatcher(std::move(callback)); }
+                else
+                {
+                    try { callback(); }
+                    catch(...) {}
+                }
+            }
+            expired.clear();
+            lock.lock();
+            continue;
+        }
+
+        _wakeTick = next_tick();
+        if(_wakeTick == UINT64_MAX) { _cv.wait(lock); }
+        else { _cv.wait_until(lock, _start + _tick * static_cast<int64_t>(_wakeTick)); }
+
+        // While awake the thread recomputes its deadline before sleeping, no need to be notified
+        _wakeTick = 0;
+    }
+}
+
+auto TimerService::to_tick(Clock::time_point time) const noexcept -> uint64_t
+{
+    const auto offset = time - _start;
+    return offset.count() <= 0 ? 0 : static_cast<uint64_t>(offset / _tick);
+}
+
+auto TimerService::insert(uint32_t index) noexcept -> void
+{
+    Entry& entry = _entries[index];
+    const uint64_t expiry = std::max(entry._expiry, _current);
+    const uint64_t delta = expiry - _current;
+
+    size_t level = 0;
+    while(level + 1 < LEVELS && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) { ++level; }
+
+    // Timers beyond the horizon wait in the top level and are placed again when it turns
+    const uint64_t horizon = (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+    const uint64_t placement = delta > horizon ? _current + horizon : expiry;
+    const size_t slot = (placement >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+    uint32_t& head = _slots[level][slot];
+    entry._level = static_cast<uint8_t>(level);
+    entry._slot = static_cast<uint8_t>(slot);
+    entry._prev = NONE;
+    entry._next = head;
+    if(head != NONE) { _entries[head]._prev = index; }
+    head = index;
+    _occupied[level] |= uint64_t(1) << slot;
+}
+
+auto TimerService::unlink(uint32_t index) noexcept -> void
+{
+    Entry& entry = _entries[index];
+    if(entry._prev != NONE) { _entries[entry._prev]._next = entry._next; }
+    else
+    {
+        _slots[entry._level][entry._slot] = entry._next;
+        if(entry._next == NONE) { _occupied[entry._level] &= ~(uint64_t(1) << entry._slot); }
+    }
+    if(entry._next != NONE) { _entries[entry._next]._prev = entry._prev; }
+}
+
+auto TimerService::release(uint32_t index) noexcept -> void
+{
+    Entry& entry = _entries[index];
+    entry._callback = nullptr;
+    entry._active = false;
+    ++entry._generation;
+    entry._prev = NONE;
+    entry._next = _free;
+    _free = index;
+    --_count;
+}
+
+auto TimerService::cascade(size_t level, size_t slot) noexcept -> void
+{
+    uint32_t index = _slots[level][slot];
+    _slots[level][slot] = NONE;
+    _occupied[level] &= ~(uint64_t(1) << slot);
+
+    while(index != NONE)
+    {
+        const uint32_t next = _entries[index]._next;
+        insert(index);
+        index = next;
+    }
+}
+
+auto TimerService::expire(size_t slot, std::vector<Task>& expired) noexcept -> void
+{
+    if((_occupied[0] & (uint64_t(1) << slot)) == 0) { return; }
+
+    uint32_t index = _slots[0][slot];
+    _slots[0][slot] = NONE;
+    _occupied[0] &= ~(uint64_t(1) << slot);
+
+    while(index != NONE)
+    {
+        const uint32_t next = _entries[index]._next;
+        expired.push_back(std::move(_entries[index]._callback));
+        release(index);
+        index = next;
+    }
+}
+
+auto TimerService::next_tick() const noexcept -> uint64_t
+{
+    if(_count == 0) { return UINT64_MAX; }
+
+    uint64_t next = UINT64_MAX;
+    if(_occupied[0] != 0)
+    {
+        next = _current + lowest_bit(rotate_right(_occupied[0], _current & (SLOTS - 1)));
+    }
+
+    // A higher level slot is due when the wheel turns into it. The slot of the turn
+    // the last processed tick belongs to has already been moved down, so it counts
+    // as a full turn ahead.
+    const uint64_t processed = _current == 0 ? 0 : _current - 1;
+    for(size_t level = 1; level < LEVELS; ++level)
+    {
+        if(_occupied[level] == 0) { continue; }
+
+        const size_t shift = SLOT_BITS * level;
+        const uint64_t turn = processed >> shift;
+        const size_t distance = lowest_bit(rotate_right(_occupied[level], (turn + 1) & (SLOTS - 1))) + 1;
+        next = std::min(next, (turn + distance) << shift);
+    }
+    return next;
+}
+} // namespace common::threading
@@ -0,0 +1,136 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/Topology.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if defined(LINUX)
+#include <dirent.h>
+#include <sched.h>
+#endif
+
+namespace common::threading
+{
+namespace detail
+{
+auto all_cpus() -> std::vector<uint32_t>
+{
+    std::vector<uint32_t> cpus;
+#if defined(LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(0 == sched_getaffinity(0, sizeof(set), &set))
+    {
+        for(uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if(CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    if(cpus.empty())
+    {
+        const uint32_t count = std::max(1u, std::thread::hardware_concurrency());
+        for(uint32_t cpu = 0; cpu < count; ++cpu) cpus.push_back(cpu);
+    }
+    return cpus;
+}
+} // namespace detail
+
+auto parse_cpu_list(const std::string& list) -> std::vector<uint32_t>
+{
+    std::vector<uint32_t> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while(std::getline(stream, range, ','))
+    {
+        const auto dash = range.find('-');
+        char* end = nullptr;
+        const auto first = std::strtoul(range.c_str(), &end, 10);
+        if(end == range.c_str()) continue;
+
+        auto last = first;
+        if(dash != std::string::npos)
+        {
+            const char* begin = range.c_str() + dash + 1;
+            last = std::strtoul(begin, &end, 10);
+            if(end == begin || last < first) continue;
+        }
+        for(auto cpu = first; cpu <= last; ++cpu) cpus.push_back(static_cast<uint32_t>(cpu));
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+auto get_numa_nodes() -> std::vector<NumaNode>
+{
+    const auto allowed = detail::all_cpus();
+    std::vector<NumaNode> nodes;
+
+#if defined(LINUX)
+    if(DIR* directory = opendir("/sys/devices/system/node"))
+    {
+        while(const dirent* entry = readdir(directory))
+        {
+            const std::string name(entry->d_name);
+            if(name.size() <= 4 || name.compare(0, 4, "node") != 0) continue;
+            if(!std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; })) continue;
+
+            std::ifstream file("/sys/devices/system/node/" + name + "/cpulist");
+            std::string list;
+            if(!std::getline(file, list)) continue;
+
+            NumaNode node;
+            node._id = static_cast<uint32_t>(std::stoul(name.substr(4)));
+            for(auto cpu : parse_cpu_list(list))
+            {
+                if(std::binary_search(allowed.begin(), allowed.end(), cpu)) node._cpus.push_back(cpu);
+            }
+            if(!node._cpus.empty()) nodes.push_back(std::move(node));
+        }
+        closedir(directory);
+    }
+#endif
+
+    if(nodes.empty()) { nodes.push_back({0, allowed}); }
+    std::sort(nodes.begin(), nodes.end(), [](const NumaNode& lhs, const NumaNode& rhs) { return lhs._id < rhs._id; });
+    return nodes;
+}
+
+auto get_isolated_cpus() -> std::vector<uint32_t>
+{
+#if defined(LINUX)
+    std::ifstream file("/sys/devices/system/cpu/isolated");
+    std::string list;
+    if(std::getline(file, list)) return parse_cpu_list(list);
+#endif
+    return {};
+}
+} // namespace common::threading
@@ -0,0 +1,92 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/WaitEvent.hpp"
+#include "common/Exception.hpp"
+
+#if defined(LINUX)
+#include <poll.h>
+#include <time.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace common::threading
+{
+WaitEvent::WaitEvent()
+{
+#if defined(LINUX)
+    _fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(_fd < 0) { throw RuntimeException("eventfd failed"); }
+#endif
+}
+
+WaitEvent::~WaitEvent()
+{
+#if defined(LINUX)
+    if(_fd >= 0) { close(_fd); }
+#endif
+}
+
+auto WaitEvent::notify() noexcept -> void
+{
+#if defined(LINUX)
+    const uint64_t one = 1;
+    [[maybe_unused]] const auto written = write(_fd, &one, sizeof(one));
+#else
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _signaled = true;
+    }
+    _cv.notify_one();
+#endif
+}
+
+auto WaitEvent::wait_for(std::chrono::nanoseconds timeout) noexcept -> bool
+{
+#if defined(LINUX)
+    uint64_t value = 0;
+    if(read(_fd, &value, sizeof(value)) == sizeof(value)) { return true; }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while(true)
+    {
+        const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+        if(remaining.count() <= 0) { return false; }
+
+        // ppoll takes a timespec, so short timeouts are not rounded up to a millisecond
+        const timespec interval{static_cast<time_t>(remaining.count() / 1000000000),
+                                static_cast<long>(remaining.count() % 1000000000)};
+        pollfd descriptor{_fd, POLLIN, 0};
+        if(ppoll(&descriptor, 1, &interval, nullptr) > 0 &&
+           read(_fd, &value, sizeof(value)) == sizeof(value)) { return true; }
+    }
+#else
+    std::unique_lock<std::mutex> lock(_lock);
+    const bool signaled = _cv.wait_for(lock, timeout, [this]() { return _signaled; });
+    _signaled = false;
+    return signaled;
+#endif
+}
+} // namespace common::threading
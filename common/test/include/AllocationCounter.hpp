@@ -0,0 +1,57 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace common::test
+{
+/**
+ * @brief Counts calls to the global operator new made while counting is enabled.
+ *
+ * The replacement operators are defined in AllocationCounter.cpp and apply to the whole
+ * test binary. Counting is off by default.
+ */
+class AllocationCounter
+{
+public :
+    static std::atomic<bool> _enabled;
+    static std::atomic<size_t> _count;
+
+public :
+    static auto start() noexcept -> void
+    {
+        _count.store(0);
+        _enabled.store(true);
+    }
+
+    static auto stop() noexcept -> size_t
+    {
+        _enabled.store(false);
+        return _count.load();
+    }
+};
+} // namespace common::test
@@ -30,7 +30,9 @@ SOFTWARE.
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 namespace common::asio::test
 {
@@ -256,4 +258,157 @@ TEST_F(test_AsyncTcp, double_connect_is_ignored)
 
     listener->stop();
 }
-} // namespace common::asio::test
\ No newline at end of file
+
+TEST_F(test_AsyncTcp, buffer_send_receive)
+{
+    const auto conn = makeConn(31005);
+    const int  messageCount = 3;
+
+    std::vector<uint8_t> sendData(64 * 1024);
+    std::iota(sendData.begin(), sendData.end(), 0);
+
+    auto received   = std::make_shared<std::vector<memory::Buffer>>();
+    auto mu         = std::make_shared<std::mutex>();
+    auto donePromise = std::make_shared<std::promise<void>>();
+    auto doneFuture  = donePromise->get_future();
+
+    auto listener = AsyncTcpListener::create(conn);
+    listener->listen([received, mu, donePromise, messageCount](std::shared_ptr<AsyncTcpSocket> client) {
+        client->receive_buffer([received, mu, donePromise, messageCount, client](memory::Buffer buffer) {
+            std::lock_guard<std::mutex> lock(*mu);
+            received->push_back(std::move(buffer));
+            if(static_cast<int>(received->size()) == messageCount) { donePromise->set_value(); }
+        });
+    });
+
+    // Sent once with the header in its headroom and twice shared, with the header in a separate block
+    auto unique = memory::Buffer::copy_of(sendData.data(), sendData.size());
+    auto shared = memory::Buffer::copy_of(sendData.data(), sendData.size());
+    auto clientSocket = AsyncTcpSocket::create(conn);
+    clientSocket->connect([clientSocket, unique, shared]() mutable {
+        clientSocket->send(std::move(unique), [clientSocket, shared](size_t) {
+            clientSocket->send(shared, [clientSocket, shared](size_t) {
+                clientSocket->send(shared);
+            });
+        });
+    });
+
+    ASSERT_EQ(doneFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::lock_guard<std::mutex> lock(*mu);
+    for(const auto& buffer : *received)
+    {
+        EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.end()), sendData);
+    }
+
+    listener->stop();
+}
+
+TEST_F(test_AsyncTcp, concurrent_send_queue)
+{
+    const auto conn = makeConn(31006);
+    const int  senderCount  = 4;
+    const int  messageCount = 500;
+
+    auto order       = std::make_shared<std::vector<int>>(senderCount, 0);
+    auto outOfOrder  = std::make_shared<std::atomic<int>>(0);
+    auto received    = std::make_shared<std::atomic<int>>(0);
+    auto donePromise = std::make_shared<std::promise<void>>();
+    auto doneFuture  = donePromise->get_future();
+
+    auto listener = AsyncTcpListener::create(conn);
+    listener->listen([=](std::shared_ptr<AsyncTcpSocket> client) {
+        client->receive([=](const std::vector<uint8_t>& buffer) {
+            const int sender   = buffer[0];
+            const int sequence = (buffer[1] << 8) | buffer[2];
+            if(sequence != (*order)[sender]++) { outOfOrder->fetch_add(1); }
+            if(received->fetch_add(1) + 1 == senderCount * messageCount) { donePromise->set_value(); }
+        });
+    });
+
+    auto writable     = std::make_shared<std::vector<bool>>();
+    auto writableLock = std::make_shared<std::mutex>();
+    auto connPromise  = std::make_shared<std::promise<void>>();
+    auto clientSocket = AsyncTcpSocket::create(conn);
+    clientSocket->set_watermarks(1, 0, [writable, writableLock](bool state) {
+        std::lock_guard<std::mutex> lock(*writableLock);
+        writable->push_back(state);
+    });
+    clientSocket->connect([connPromise]() { connPromise->set_value(); });
+    connPromise->get_future().wait();
+
+    std::vector<std::thread> senders;
+    for(int sender = 0; sender < senderCount; ++sender)
+    {
+        senders.emplace_back([clientSocket, sender, messageCount]() {
+            for(int sequence = 0; sequence < messageCount; ++sequence)
+            {
+                clientSocket->send(std::vector<uint8_t>{static_cast<uint8_t>(sender), 
+                                                        static_cast<uint8_t>(sequence >> 8), 
+                                                        static_cast<uint8_t>(sequence & 0xFF)});
+            }
+        });
+    }
+    for(auto& sender : senders) { sender.join(); }
+
+    ASSERT_EQ(doneFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(outOfOrder->load(), 0);
+
+    // The last completions may still be running on the IOContext
+    auto drained = [&clientSocket, &writable, &writableLock]() {
+        std::lock_guard<std::mutex> lock(*writableLock);
+        return clientSocket->queued_bytes() == 0 && (writable->empty() || writable->back());
+    };
+    for(int i = 0; i < 100 && !drained(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(clientSocket->queued_bytes(), 0);
+    EXPECT_TRUE(clientSocket->writable());
+
+    std::lock_guard<std::mutex> lock(*writableLock);
+    ASSERT_FALSE(writable->empty());
+    for(size_t i = 0; i < writable->size(); ++i)
+    {
+        EXPECT_EQ((*writable)[i], i % 2 == 1);
+    }
+    EXPECT_TRUE(writable->back());
+
+    listener->stop();
+}
+
+TEST_F(test_AsyncTcp, batched_receive)
+{
+    const auto conn = makeConn(31007);
+    const int  messageCount = 1000;
+
+    auto batches     = std::make_shared<std::atomic<int>>(0);
+    auto received    = std::make_shared<std::vector<int>>();
+    auto donePromise = std::make_shared<std::promise<void>>();
+    auto doneFuture  = donePromise->get_future();
+
+    auto listener = AsyncTcpListener::create(conn);
+    listener->listen([=](std::shared_ptr<AsyncTcpSocket> client) {
+        client->receive_batch([=](Span<const Span<const uint8_t>> messages) {
+            batches->fetch_add(1);
+            for(const auto& message : messages) { received->push_back((message[0] << 8) | message[1]); }
+            if(static_cast<int>(received->size()) == messageCount) { donePromise->set_value(); }
+        }, [client](const auto&) {});
+    });
+
+    auto clientSocket = AsyncTcpSocket::create(conn);
+    clientSocket->connect([clientSocket, messageCount]() {
+        for(int i = 0; i < messageCount; ++i)
+        {
+            clientSocket->send(std::vector<uint8_t>{static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i & 0xFF)});
+        }
+    });
+
+    ASSERT_EQ(doneFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::vector<int> expected(messageCount);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(*received, expected);
+    EXPECT_LT(batches->load(), messageCount);
+
+    listener->stop();
+}
+} // namespace common::asio::test
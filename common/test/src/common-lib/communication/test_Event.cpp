@@ -25,6 +25,7 @@ SOFTWARE.
 
 #include "common/asio/IOContext.hpp"
 #include "common/asio/AsyncEventBroker.hpp"
+#include "common/asio/AsyncEventTransport.hpp"
 #include "common/communication/Event.hpp"
 
 namespace common::communication::test
@@ -62,6 +63,7 @@ public:
             {"double_regist",                  38006},
             {"double_subscribe",               38007},
             {"unsubscribe",                    38008},
+            {"buffer_subscription",            38009},
         };
 
         conn._protocol = Protocol::TCP;
@@ -291,4 +293,30 @@ TEST_F(test_Event, unsubscribe)
     std::this_thread::sleep_for(std::chrono::milliseconds(200));
     ASSERT_EQ(recvCount->load(), 1);
 }
-} // namespace common::communication::test
\ No newline at end of file
+
+TEST_F(test_Event, buffer_subscription)
+{
+    // given
+    const Bytes payload = {1, 2, 3};
+    auto promise = std::make_shared<std::promise<memory::Buffer>>();
+    auto future  = promise->get_future();
+
+    auto publisher = std::make_shared<asio::TcpTransport>(conn, 30);
+    publisher->connect();
+
+    // when
+    auto subscriber = std::make_shared<asio::TcpTransport>(conn, 30);
+    subscriber->subscribe_buffer([promise](memory::Buffer buffer) {
+        promise->set_value(std::move(buffer));
+    }, [publisher, payload]() {
+        publisher->publish(payload);
+    });
+
+    // then
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    auto buffer = future.get();
+    ASSERT_EQ(Bytes(buffer.begin(), buffer.end()), payload);
+    subscriber->disconnect();
+    publisher->disconnect();
+}
+} // namespace common::communication::test
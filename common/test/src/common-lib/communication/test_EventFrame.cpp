@@ -0,0 +1,84 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/communication/EventFrame.hpp"
+
+namespace common::communication::test
+{
+TEST(test_EventFrame, make_and_parse)
+{
+    // given
+    const Bytes payload = {1, 2, 3};
+
+    // when
+    auto raw = Frame::make(0x1234, Frame::DATA, payload);
+    auto frame = Frame::parse(raw);
+    auto view = FrameView::parse(raw);
+
+    // then
+    ASSERT_EQ(frame._topic, 0x1234);
+    ASSERT_EQ(frame._type, Frame::DATA);
+    ASSERT_EQ(frame.payload, payload);
+    ASSERT_EQ(view._topic, 0x1234);
+    ASSERT_EQ(view._type, Frame::DATA);
+    ASSERT_EQ(view._payload.data(), raw.data() + Frame::HEADER_SIZE);
+    ASSERT_EQ(view.to_frame().payload, payload);
+}
+
+TEST(test_EventFrame, make_in_headroom)
+{
+    // given
+    const Bytes payload = {1, 2, 3};
+    auto buffer = memory::Buffer::copy_of(payload.data(), payload.size());
+    const uint8_t* first = buffer.data();
+
+    // when
+    auto raw = Frame::make(7, Frame::DATA, std::move(buffer));
+    auto view = FrameView::parse(raw);
+
+    // then
+    ASSERT_EQ(raw.data() + Frame::HEADER_SIZE, first);
+    ASSERT_EQ(Bytes(raw.begin(), raw.end()), Frame::make(7, Frame::DATA, payload));
+    ASSERT_EQ(view._topic, 7);
+    ASSERT_EQ(Bytes(view._payload.begin(), view._payload.end()), payload);
+}
+
+TEST(test_EventFrame, make_from_shared_buffer)
+{
+    // given
+    const Bytes payload = {1, 2, 3};
+    auto buffer = memory::Buffer::copy_of(payload.data(), payload.size());
+    auto shared = buffer;
+
+    // when
+    auto raw = Frame::make(7, Frame::ACK, buffer);
+
+    // then
+    ASSERT_NE(raw.data() + Frame::HEADER_SIZE, shared.data());
+    ASSERT_EQ(Bytes(raw.begin(), raw.end()), Frame::make(7, Frame::ACK, payload));
+    ASSERT_EQ(Bytes(shared.begin(), shared.end()), payload);
+}
+} // namespace common::communication::test
@@ -0,0 +1,165 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/LockFreeWorkQueue.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+TEST(test_LockFreeWorkQueue, push_pop_steal_order)
+{
+    // given
+    LockFreeWorkQueue<int32_t> queue(4);
+    for(int32_t i = 0; i < 4; ++i) { queue.push(i); }
+
+    // when
+    int32_t popped = -1;
+    int32_t stolen = -1;
+    const bool pop = queue.pop(popped);
+    const bool steal = queue.steal(stolen);
+
+    // then
+    ASSERT_TRUE(pop && steal);
+    ASSERT_EQ(popped, 3);   // owner takes the newest
+    ASSERT_EQ(stolen, 0);   // thieves take the oldest
+    ASSERT_EQ(queue.size(), 2u);
+}
+
+TEST(test_LockFreeWorkQueue, move_only_grow_and_shrink)
+{
+    // given
+    LockFreeWorkQueue<std::unique_ptr<int32_t>> queue(2);
+    constexpr int32_t count = 1000;
+
+    // when
+    for(int32_t i = 0; i < count; ++i) { queue.push(std::make_unique<int32_t>(i)); }
+    const size_t grownCapacity = queue.getCapacity();
+
+    int64_t sum = 0;
+    std::unique_ptr<int32_t> value;
+    while(queue.pop(value)) { sum += *value; }
+
+    // then
+    ASSERT_GE(grownCapacity, static_cast<size_t>(count));
+    ASSERT_GT(queue.getResizeCount(), 0u);
+    ASSERT_GT(queue.getShrinkCount(), 0u);
+    ASSERT_LT(queue.getCapacity(), grownCapacity);
+    ASSERT_EQ(queue.getMaxSize(), static_cast<size_t>(count));
+    ASSERT_EQ(sum, int64_t{count} * (count - 1) / 2);
+}
+
+TEST(test_LockFreeWorkQueue, destroys_remaining_items)
+{
+    // given
+    auto item = std::make_shared<int32_t>(0);
+
+    // when
+    {
+        LockFreeWorkQueue<std::shared_ptr<int32_t>> queue(2);
+        for(int32_t i = 0; i < 10; ++i) { queue.push(item); }
+    }
+
+    // then
+    ASSERT_EQ(item.use_count(), 1);
+}
+
+// Meant to be run under ThreadSanitizer as well: the owner keeps growing and shrinking
+// the ring while thieves steal, so retired arrays are read and reclaimed concurrently.
+template <typename T, typename Make, typename Read>
+auto stress(Make make, Read read) -> void
+{
+    // given
+    LockFreeWorkQueue<T> queue(2);
+    constexpr int64_t rounds = 200;
+    constexpr int64_t perRound = 500;
+    constexpr int64_t thieves = 3;
+    std::atomic<bool> done{false};
+    std::atomic<int64_t> stolenSum{0};
+    std::atomic<int64_t> stolenCount{0};
+    int64_t poppedSum = 0;
+    int64_t poppedCount = 0;
+
+    // when
+    std::vector<std::thread> threads;
+    for(int64_t t = 0; t < thieves; ++t)
+    {
+        threads.emplace_back([&]() {
+            T value{};
+            while(!done.load())
+            {
+                if(queue.steal(value))
+                {
+                    stolenSum.fetch_add(read(value));
+                    stolenCount.fetch_add(1);
+                }
+                else { std::this_thread::yield(); }
+            }
+        });
+    }
+
+    int64_t next = 1;
+    T value{};
+    for(int64_t round = 0; round < rounds; ++round)
+    {
+        for(int64_t i = 0; i < perRound; ++i) { queue.push(make(next++)); }
+        // Drain most of the queue so that it shrinks again
+        while(queue.size() > 4 && queue.pop(value))
+        {
+            poppedSum += read(value);
+            ++poppedCount;
+        }
+    }
+    while(queue.pop(value))
+    {
+        poppedSum += read(value);
+        ++poppedCount;
+    }
+    while(!queue.empty()) { std::this_thread::yield(); }
+    done.store(true);
+    for(auto& thread : threads) { thread.join(); }
+
+    // then
+    const int64_t total = rounds * perRound;
+    ASSERT_EQ(poppedCount + stolenCount.load(), total);
+    ASSERT_EQ(poppedSum + stolenSum.load(), total * (total + 1) / 2);
+    ASSERT_GT(queue.getShrinkCount(), 0u);
+}
+
+TEST(test_LockFreeWorkQueue, stress_pointer)
+{
+    stress<int64_t>([](int64_t i) { return i; }, [](int64_t i) { return i; });
+}
+
+TEST(test_LockFreeWorkQueue, stress_move_only)
+{
+    stress<std::unique_ptr<int64_t>>([](int64_t i) { return std::make_unique<int64_t>(i); },
+                                     [](const std::unique_ptr<int64_t>& i) { return *i; });
+}
+} // namespace common::test
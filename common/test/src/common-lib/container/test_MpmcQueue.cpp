@@ -0,0 +1,161 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/MpmcQueue.hpp"
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+TEST(test_MpmcQueue, try_push_try_pop)
+{
+    // given
+    MpmcQueue<std::string> queue(3);
+
+    // when
+    const bool first = queue.try_push("a");
+    const bool second = queue.try_push(std::string("b"));
+    const bool third = queue.try_emplace(2, 'c');
+    const bool fourth = queue.try_push("d");
+    const bool fifth = queue.try_push("e");
+
+    std::vector<std::string> popped;
+    std::string value;
+    while(queue.try_pop(value)) { popped.push_back(value); }
+
+    // then
+    ASSERT_EQ(queue.capacity(), 4u);
+    ASSERT_TRUE(first && second && third && fourth);
+    ASSERT_FALSE(fifth);
+    ASSERT_EQ(popped, (std::vector<std::string>{"a", "b", "cc", "d"}));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(test_MpmcQueue, push_n_pop_n)
+{
+    // given
+    MpmcQueue<std::unique_ptr<int32_t>> queue(8);
+    std::vector<std::unique_ptr<int32_t>> input;
+    for(int32_t i = 0; i < 10; ++i) { input.push_back(std::make_unique<int32_t>(i)); }
+
+    // when
+    const size_t pushed = queue.push_n(input.begin(), input.size());
+    std::vector<std::unique_ptr<int32_t>> output(10);
+    const size_t popped = queue.pop_n(output.begin(), 5);
+    const size_t rest = queue.pop_n(output.begin() + 5, 5);
+
+    // then
+    ASSERT_EQ(pushed, 8u);
+    ASSERT_EQ(popped, 5u);
+    ASSERT_EQ(rest, 3u);
+    for(int32_t i = 0; i < 8; ++i) { ASSERT_EQ(*output[i], i); }
+    ASSERT_NE(input[8], nullptr);
+    ASSERT_EQ(queue.pop_n(output.begin(), 1), 0u);
+}
+
+TEST(test_MpmcQueue, blocking_multi_producer_multi_consumer)
+{
+    // given
+    MpmcQueue<int64_t> queue(16);
+    constexpr int64_t producers = 4;
+    constexpr int64_t consumers = 4;
+    constexpr int64_t perProducer = 20000;
+    std::atomic<int64_t> sum{0};
+    std::atomic<int64_t> count{0};
+
+    // when
+    std::vector<std::thread> threads;
+    for(int64_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, p]() {
+            std::vector<int64_t> batch;
+            for(int64_t i = 0; i < perProducer; ++i)
+            {
+                const int64_t value = p * perProducer + i + 1;
+                if(i % 2 == 0) { ASSERT_TRUE(queue.push(value)); }
+                else
+                {
+                    batch.assign(1, value);
+                    while(queue.push_n(batch.begin(), 1) == 0) { std::this_thread::yield(); }
+                }
+            }
+        });
+    }
+    for(int64_t c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&queue, &sum, &count, c]() {
+            int64_t value = 0;
+            std::vector<int64_t> batch(4);
+            while(true)
+            {
+                if(c % 2 == 0)
+                {
+                    const size_t taken = queue.pop_n(batch.begin(), batch.size());
+                    if(taken > 0)
+                    {
+                        sum.fetch_add(std::accumulate(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(taken), int64_t{0}));
+                        count.fetch_add(static_cast<int64_t>(taken));
+                        continue;
+                    }
+                }
+                if(!queue.pop(value)) { break; }
+                sum.fetch_add(value);
+                count.fetch_add(1);
+            }
+        });
+    }
+    for(int64_t p = 0; p < producers; ++p) { threads[p].join(); }
+    queue.close();
+    for(size_t i = producers; i < threads.size(); ++i) { threads[i].join(); }
+
+    // then
+    const int64_t total = producers * perProducer;
+    ASSERT_EQ(count.load(), total);
+    ASSERT_EQ(sum.load(), total * (total + 1) / 2);
+    ASSERT_FALSE(queue.push(1));
+}
+
+TEST(test_MpmcQueue, destroys_remaining_items)
+{
+    // given
+    auto item = std::make_shared<int32_t>(0);
+
+    // when
+    {
+        MpmcQueue<std::shared_ptr<int32_t>> queue(4);
+        queue.push(item);
+        queue.push(item);
+    }
+
+    // then
+    ASSERT_EQ(item.use_count(), 1);
+}
+} // namespace common::test
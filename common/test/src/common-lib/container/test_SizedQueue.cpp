@@ -0,0 +1,229 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/SizedQueue.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+TEST(test_SizedQueue, drops_oldest_when_full)
+{
+    // given
+    SizedQueue<std::string, 3> queue;
+
+    // when
+    for(const char* value : {"a", "b", "c", "d", "e"}) { queue.push_back(value); }
+
+    // then
+    ASSERT_TRUE(queue.full());
+    ASSERT_EQ(queue.size(), 3u);
+    ASSERT_EQ(queue.front(), "c");
+    ASSERT_EQ(queue.back(), "e");
+    ASSERT_EQ(queue[1], "d");
+
+    queue.pop_front();
+    ASSERT_EQ(queue.front(), "d");
+    ASSERT_EQ(queue.size(), 2u);
+}
+
+TEST(test_SizedQueue, emplace_forwards_arguments)
+{
+    // given
+    SizedQueue<std::unique_ptr<int>, 2> queue;
+
+    // when
+    queue.emplace_back(new int(1));
+    queue.push_back(std::make_unique<int>(2));
+    queue.emplace_back(std::make_unique<int>(3));
+
+    // then
+    ASSERT_EQ(queue.size(), 2u);
+    ASSERT_EQ(*queue.front(), 2);
+    ASSERT_EQ(*queue.back(), 3);
+}
+
+TEST(test_SizedQueue, destroys_dropped_elements)
+{
+    // given
+    auto tracker = std::make_shared<int>(0);
+
+    // when
+    {
+        SizedQueue<std::shared_ptr<int>, 4> queue;
+        for(int i = 0; i < 10; ++i) { queue.push_back(tracker); }
+        ASSERT_EQ(tracker.use_count(), 5);
+
+        SizedQueue<std::shared_ptr<int>, 4> copy(queue);
+        ASSERT_EQ(tracker.use_count(), 9);
+    }
+
+    // then
+    ASSERT_EQ(tracker.use_count(), 1);
+}
+
+TEST(test_SizedQueue, throwing_emplace_when_full_keeps_queue_consistent)
+{
+    // given
+    struct Fragile
+    {
+        std::shared_ptr<int> _tracker;
+        Fragile(std::shared_ptr<int> tracker, bool fail) : _tracker(std::move(tracker))
+        {
+            if(fail) { throw std::runtime_error("construction failed"); }
+        }
+    };
+    auto tracker = std::make_shared<int>(0);
+    SizedQueue<Fragile, 3> queue;
+    for(int i = 0; i < 3; ++i) { queue.emplace_back(tracker, false); }
+
+    // when
+    ASSERT_THROW(queue.emplace_back(tracker, true), std::runtime_error);
+
+    // then
+    ASSERT_EQ(queue.size(), 2u);
+    ASSERT_EQ(tracker.use_count(), 3);
+
+    queue.emplace_back(tracker, false);
+    queue.emplace_back(tracker, false);
+    ASSERT_EQ(queue.size(), 3u);
+    ASSERT_EQ(tracker.use_count(), 4);
+}
+
+TEST(test_SizedQueue, spans_cover_contents_in_order)
+{
+    // given
+    SizedQueue<int, 5> queue;
+    for(int i = 0; i < 7; ++i) { queue.push_back(i); }
+
+    // when
+    auto [first, second] = queue.spans();
+    std::vector<int> joined(first.begin(), first.end());
+    joined.insert(joined.end(), second.begin(), second.end());
+
+    // then
+    ASSERT_EQ(first.size(), 3u);
+    ASSERT_EQ(second.size(), 2u);
+    ASSERT_EQ(joined, (std::vector<int>{2, 3, 4, 5, 6}));
+}
+
+TEST(test_SizedQueue, linearize_makes_contents_contiguous)
+{
+    for(size_t popped : {0, 1, 3})
+    {
+        // given
+        SizedQueue<std::string, 5> queue;
+        for(int i = 0; i < 8; ++i) { queue.push_back(std::to_string(i)); }
+        for(size_t i = 0; i < popped; ++i) { queue.pop_front(); }
+        queue.push_back("8");
+
+        // when
+        Span<std::string> window = queue.linearize();
+
+        // then
+        std::vector<std::string> expected;
+        for(size_t i = popped == 0 ? 4 : 3 + popped; i <= 8; ++i) { expected.push_back(std::to_string(i)); }
+        ASSERT_EQ(std::vector<std::string>(window.begin(), window.end()), expected);
+        ASSERT_TRUE(queue.spans().second.empty());
+        ASSERT_EQ(queue.front(), expected.front());
+        ASSERT_EQ(queue.back(), "8");
+
+        queue.push_back("9");
+        ASSERT_EQ(queue.back(), "9");
+    }
+}
+
+TEST(test_SizedQueue, seqlock_snapshot)
+{
+    // given
+    SizedQueue<double, 4, true> queue;
+    std::array<double, 4> out{};
+
+    // when
+    for(int i = 0; i < 6; ++i) { queue.push_back(i * 0.5); }
+    const size_t count = queue.snapshot(out);
+
+    // then
+    ASSERT_EQ(count, 4u);
+    ASSERT_EQ(out, (std::array<double, 4>{1.0, 1.5, 2.0, 2.5}));
+    ASSERT_EQ(queue.back(), 2.5);
+    ASSERT_EQ(queue.version(), 6u);
+}
+
+TEST(test_SizedQueue, seqlock_readers_see_consistent_windows)
+{
+    struct Sample
+    {
+        uint64_t _index;
+        uint64_t _check;
+        double _value;
+    };
+
+    // given
+    constexpr size_t WINDOW = 16;
+    constexpr uint64_t SAMPLES = 200000;
+    SizedQueue<Sample, WINDOW, true> queue;
+    std::atomic<bool> done{false};
+    std::atomic<size_t> failures{0};
+    std::atomic<size_t> snapshots{0};
+
+    // when
+    std::vector<std::thread> readers;
+    for(int r = 0; r < 3; ++r)
+    {
+        readers.emplace_back([&]() {
+            std::array<Sample, WINDOW> out;
+            while(!done.load())
+            {
+                const size_t count = queue.snapshot(out);
+                for(size_t i = 0; i < count; ++i)
+                {
+                    const bool torn = out[i]._check != ~out[i]._index;
+                    const bool gap = i != 0 && out[i]._index != out[i - 1]._index + 1;
+                    if(torn || gap) { failures.fetch_add(1); }
+                }
+                snapshots.fetch_add(1);
+            }
+        });
+    }
+
+    for(uint64_t i = 0; i < SAMPLES; ++i) { queue.push_back(Sample{i, ~i, static_cast<double>(i)}); }
+    done.store(true);
+    for(auto& reader : readers) { reader.join(); }
+
+    // then
+    ASSERT_EQ(failures.load(), 0u);
+    ASSERT_GT(snapshots.load(), 0u);
+    ASSERT_EQ(queue.back()._index, SAMPLES - 1);
+}
+} // namespace common::test
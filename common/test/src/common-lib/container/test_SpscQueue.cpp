@@ -0,0 +1,145 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/SpscQueue.hpp"
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+TEST(test_SpscQueue, emplace_and_pop)
+{
+    // given
+    SpscQueue<std::string> queue(3);
+
+    // when
+    const bool first = queue.try_emplace(3, 'a');
+    const bool second = queue.try_push(std::string("b"));
+    const bool third = queue.try_push("c");
+    const bool fourth = queue.try_push("d");
+    const bool fifth = queue.try_push("e");
+    const std::string front = *queue.front();
+
+    std::vector<std::string> popped;
+    std::string value;
+    while(queue.try_pop(value)) { popped.push_back(value); }
+
+    // then
+    ASSERT_EQ(queue.capacity(), 4u);
+    ASSERT_TRUE(first && second && third && fourth);
+    ASSERT_FALSE(fifth);
+    ASSERT_EQ(front, "aaa");
+    ASSERT_EQ(popped, (std::vector<std::string>{"aaa", "b", "c", "d"}));
+    ASSERT_EQ(queue.front(), nullptr);
+}
+
+TEST(test_SpscQueue, spans_wrap_around)
+{
+    // given
+    SpscQueue<uint8_t> queue(8);
+    const std::vector<uint8_t> input{1, 2, 3, 4, 5, 6};
+    std::vector<uint8_t> output(6);
+    queue.write(input.data(), input.size());
+    queue.read(output.data(), 4);
+
+    // when
+    auto free = queue.write_span();
+    const size_t firstFree = free.size();
+    for(size_t i = 0; i < free.size(); ++i) { free[i] = static_cast<uint8_t>(10 + i); }
+    queue.commit_write(free.size());
+    const size_t secondFree = queue.write_span().size();
+
+    auto filled = queue.read_span();
+    const std::vector<uint8_t> head(filled.begin(), filled.end());
+    queue.commit_read(filled.size());
+    const size_t rest = queue.read(output.data(), output.size());
+
+    // then
+    ASSERT_EQ(firstFree, 2u);   // up to the end of the ring
+    ASSERT_EQ(secondFree, 4u);  // the wrapped part
+    ASSERT_EQ(head, (std::vector<uint8_t>{5, 6, 10, 11}));
+    ASSERT_EQ(rest, 0u);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(test_SpscQueue, producer_consumer)
+{
+    for(bool blocking : {false, true})
+    {
+        // given
+        SpscQueue<uint64_t> queue(64, blocking);
+        constexpr uint64_t count = 200000;
+        uint64_t sum = 0;
+        uint64_t received = 0;
+
+        // when
+        std::thread producer([&queue]() {
+            for(uint64_t i = 1; i <= count; ++i)
+            {
+                while(!queue.try_push(i)) { std::this_thread::yield(); }
+                if(i % 10000 == 0) { std::this_thread::sleep_for(std::chrono::microseconds(200)); }
+            }
+        });
+        uint64_t value = 0;
+        while(received < count)
+        {
+            if(queue.try_pop(value))
+            {
+                ASSERT_EQ(value, received + 1);
+                sum += value;
+                ++received;
+                continue;
+            }
+            queue.wait(std::chrono::milliseconds(100));
+        }
+        producer.join();
+
+        // then
+        ASSERT_EQ(sum, count * (count + 1) / 2);
+        ASSERT_FALSE(queue.wait(std::chrono::milliseconds(1)));
+    }
+}
+
+TEST(test_SpscQueue, destroys_remaining_items)
+{
+    // given
+    auto item = std::make_shared<int32_t>(0);
+
+    // when
+    {
+        SpscQueue<std::shared_ptr<int32_t>> queue(4);
+        queue.try_push(item);
+        queue.try_push(item);
+    }
+
+    // then
+    ASSERT_EQ(item.use_count(), 1);
+}
+} // namespace common::test
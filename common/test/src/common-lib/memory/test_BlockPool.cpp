@@ -0,0 +1,104 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/memory/BlockPool.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace common::memory::test
+{
+TEST(test_BlockPool, reuse_released_block)
+{
+    // given
+    void* first = BlockPool::allocate(48);
+    BlockPool::deallocate(first, 48);
+
+    // when
+    void* second = BlockPool::allocate(64);
+
+    // then
+    ASSERT_EQ(first, second);
+    BlockPool::deallocate(second, 64);
+}
+
+TEST(test_BlockPool, large_block)
+{
+    // given
+    const size_t size = BlockPool::MAX_BLOCK_SIZE + 1;
+
+    // when
+    auto* block = static_cast<uint8_t*>(BlockPool::allocate(size));
+    block[0] = 1;
+    block[size - 1] = 2;
+
+    // then
+    ASSERT_EQ(block[0] + block[size - 1], 3);
+    BlockPool::deallocate(block, size);
+}
+
+TEST(test_BlockPool, release_on_other_thread)
+{
+    // given
+    constexpr size_t count = 1000;
+    std::vector<void*> blocks;
+    for(size_t i = 0; i < count; ++i)
+    {
+        auto* block = static_cast<size_t*>(BlockPool::allocate(sizeof(size_t) * 16));
+        block[0] = i;
+        blocks.push_back(block);
+    }
+
+    // when
+    std::thread consumer([&blocks]() {
+        for(size_t i = 0; i < blocks.size(); ++i)
+        {
+            ASSERT_EQ(static_cast<size_t*>(blocks[i])[0], i);
+            BlockPool::deallocate(blocks[i], sizeof(size_t) * 16);
+        }
+    });
+    consumer.join();
+
+    // then
+    std::vector<void*> reused;
+    for(size_t i = 0; i < count; ++i) { reused.push_back(BlockPool::allocate(sizeof(size_t) * 16)); }
+    for(auto* block : reused) { BlockPool::deallocate(block, sizeof(size_t) * 16); }
+    ASSERT_EQ(reused.size(), count);
+}
+
+TEST(test_BlockPool, pool_allocator)
+{
+    // given
+    std::vector<int32_t, PoolAllocator<int32_t>> values;
+
+    // when
+    for(int32_t i = 0; i < 100; ++i) { values.push_back(i); }
+
+    // then
+    ASSERT_EQ(values.size(), 100);
+    ASSERT_EQ(values.back(), 99);
+}
+} // namespace common::memory::test
@@ -0,0 +1,152 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/memory/Buffer.hpp"
+#include "common/Exception.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace common::memory::test
+{
+TEST(test_Buffer, reuse_released_buffer)
+{
+    // given
+    auto first = Buffer::allocate(60 * 1024);
+    const uint8_t* memory = first.data();
+    first.reset();
+
+    // when
+    auto second = Buffer::allocate(50 * 1024);
+
+    // then
+    ASSERT_EQ(second.data(), memory);
+    ASSERT_EQ(second.size(), 50 * 1024);
+}
+
+TEST(test_Buffer, copy_shares_bytes)
+{
+    // given
+    const uint8_t bytes[] = {1, 2, 3, 4};
+    auto buffer = Buffer::copy_of(bytes, sizeof(bytes));
+
+    // when
+    Buffer copy = buffer;
+
+    // then
+    ASSERT_EQ(copy.data(), buffer.data());
+    ASSERT_EQ(buffer.use_count(), 2);
+    copy.reset();
+    ASSERT_EQ(buffer.use_count(), 1);
+    ASSERT_EQ(std::memcmp(buffer.data(), bytes, sizeof(bytes)), 0);
+}
+
+TEST(test_Buffer, prepend_and_consume)
+{
+    // given
+    const uint8_t payload[] = {5, 6, 7};
+    auto buffer = Buffer::copy_of(payload, sizeof(payload), 4);
+    const uint8_t* first = buffer.data();
+
+    // when
+    uint8_t* header = buffer.prepend(2);
+    header[0] = 1;
+    header[1] = 2;
+
+    // then
+    ASSERT_EQ(header + 2, first);
+    ASSERT_EQ(buffer.size(), 5);
+    ASSERT_EQ(buffer.headroom(), 2);
+    ASSERT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.end()), (std::vector<uint8_t>{1, 2, 5, 6, 7}));
+
+    buffer.consume(2);
+    ASSERT_EQ(buffer.data(), first);
+    ASSERT_EQ(buffer.size(), 3);
+}
+
+TEST(test_Buffer, prepend_errors)
+{
+    // given
+    auto buffer = Buffer::allocate(8, 2);
+
+    // when, then
+    ASSERT_THROW(buffer.prepend(3), OutOfRangeException);
+    Buffer copy = buffer;
+    ASSERT_THROW(buffer.prepend(1), BadHandlingException);
+    ASSERT_THROW(buffer.consume(9), OutOfRangeException);
+}
+
+TEST(test_Buffer, slice_shares_bytes)
+{
+    // given
+    const uint8_t bytes[] = {1, 2, 3, 4, 5};
+    auto buffer = Buffer::copy_of(bytes, sizeof(bytes));
+
+    // when
+    auto slice = buffer.slice(1, 3);
+
+    // then
+    ASSERT_EQ(slice.data(), buffer.data() + 1);
+    ASSERT_EQ(slice.size(), 3);
+    ASSERT_EQ(slice.headroom(), buffer.headroom() + 1);
+    ASSERT_EQ(buffer.use_count(), 2);
+    ASSERT_THROW(buffer.slice(4, 2), OutOfRangeException);
+}
+
+TEST(test_Buffer, large_buffer)
+{
+    // given
+    const size_t size = Buffer::MAX_POOLED_SIZE + 1;
+
+    // when
+    auto buffer = Buffer::allocate(size);
+    buffer.data()[0] = 1;
+    buffer.data()[size - 1] = 2;
+
+    // then
+    ASSERT_EQ(buffer.size(), size);
+    ASSERT_EQ(buffer.data()[0] + buffer.data()[size - 1], 3);
+}
+
+TEST(test_Buffer, release_on_other_thread)
+{
+    // given
+    constexpr size_t COUNT = 1000;
+    std::vector<Buffer> buffers;
+    for(size_t i = 0; i < COUNT; ++i) { buffers.push_back(Buffer::allocate(1024 + i)); }
+
+    // when
+    std::vector<Buffer> shared = buffers;
+    std::thread releaser([&shared]() { shared.clear(); });
+    buffers.clear();
+    releaser.join();
+
+    // then
+    auto buffer = Buffer::allocate(1024);
+    ASSERT_EQ(buffer.use_count(), 1);
+}
+} // namespace common::memory::test
@@ -0,0 +1,201 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/Future.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace common::threading::test
+{
+TEST(test_Future, spawn_and_get)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(2, mode);
+
+        // when
+        auto future = spawn(*executor, []() { return 42; });
+        auto nothing = spawn(*executor, []() {});
+
+        // then
+        ASSERT_EQ(future.get(), 42);
+        ASSERT_FALSE(future.valid());
+        ASSERT_NO_THROW(nothing.get());
+    }
+}
+
+TEST(test_Future, then_chain)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(2, mode);
+
+        // when
+        auto future = spawn(*executor, []() { return 20; })
+            .then([](int32_t value) { return value + 1; })
+            .then([](int32_t value) { return std::to_string(value * 2); })
+            .then([](std::string value) { return value + "!"; });
+
+        // then
+        ASSERT_EQ(future.get(), "42!");
+    }
+}
+
+TEST(test_Future, then_move_only)
+{
+    // given
+    auto executor = TaskExecutor::create(2, TaskExecutor::Mode::LOCK_FREE);
+
+    // when
+    auto future = spawn(*executor, []() { return std::make_unique<int32_t>(7); })
+        .then([](std::unique_ptr<int32_t> value) { return *value; });
+
+    // then
+    ASSERT_EQ(future.get(), 7);
+}
+
+TEST(test_Future, then_forwards_exception)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    std::atomic<bool> called{false};
+
+    // when
+    auto future = spawn(*executor, []() -> int32_t { throw std::runtime_error("failed"); })
+        .then([&called](int32_t value) {
+            called.store(true);
+            return value;
+        });
+
+    // then
+    ASSERT_THROW(future.get(), std::runtime_error);
+    ASSERT_FALSE(called.load());
+}
+
+TEST(test_Future, promise)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    Promise<int32_t> promise(executor.get());
+    auto future = promise.get_future().then([](int32_t value) { return value * 2; });
+
+    // when
+    ASSERT_FALSE(future.is_ready());
+    promise.set_value(21);
+
+    // then
+    ASSERT_EQ(future.get(), 42);
+    ASSERT_THROW(promise.set_value(1), BadHandlingException);
+    ASSERT_THROW(promise.get_future(), BadHandlingException);
+}
+
+TEST(test_Future, broken_promise)
+{
+    // given
+    Future<int32_t> future;
+    {
+        Promise<int32_t> promise;
+        future = promise.get_future();
+    }
+
+    // then
+    ASSERT_TRUE(future.is_ready());
+    ASSERT_THROW(future.get(), BadHandlingException);
+}
+
+TEST(test_Future, nested_wait_in_worker)
+{
+    // given
+    auto executor = TaskExecutor::create(1);
+
+    // when
+    auto future = spawn(*executor, [&executor]() {
+        // Waiting on a single worker would deadlock if get() did not help the executor
+        return spawn(*executor, []() { return 5; }).get() + 1;
+    });
+
+    // then
+    ASSERT_EQ(future.get(), 6);
+}
+
+TEST(test_Future, when_all)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::vector<Future<int32_t>> futures;
+        for(int32_t i = 0; i < 100; ++i)
+        {
+            futures.push_back(spawn(*executor, [i]() { return i; }));
+        }
+
+        // when
+        auto all = when_all(std::move(futures)).then([](std::vector<Future<int32_t>> ready) {
+            int32_t sum = 0;
+            for(auto& future : ready) { sum += future.get(); }
+            return sum;
+        });
+        auto mixed = when_all(spawn(*executor, []() { return 1; }),
+                              spawn(*executor, []() {}),
+                              spawn(*executor, []() { return std::string("a"); }));
+        auto empty = when_all(std::vector<Future<int32_t>>());
+
+        // then
+        ASSERT_EQ(all.get(), 99 * 100 / 2);
+        auto [first, second, third] = mixed.get();
+        ASSERT_EQ(first.get(), 1);
+        ASSERT_NO_THROW(second.get());
+        ASSERT_EQ(third.get(), "a");
+        ASSERT_TRUE(empty.get().empty());
+    }
+}
+
+TEST(test_Future, when_any)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    Promise<int32_t> never;
+    std::vector<Future<int32_t>> futures;
+    futures.push_back(never.get_future());
+    futures.push_back(spawn(*executor, []() { return 3; }));
+
+    // when
+    auto result = when_any(std::move(futures)).get();
+
+    // then
+    ASSERT_EQ(result._index, 1);
+    ASSERT_EQ(result._futures.size(), 2);
+    ASSERT_EQ(result._futures[1].get(), 3);
+    ASSERT_FALSE(result._futures[0].is_ready());
+}
+} // namespace common::threading::test
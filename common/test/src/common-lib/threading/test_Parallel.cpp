@@ -0,0 +1,175 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/Parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace common::threading::parallel::test
+{
+TEST(test_Parallel, parallel_for)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::vector<int32_t> values(10000, 0);
+
+        // when
+        parallel_for(*executor, size_t{0}, values.size(), [&values](size_t i) {
+            values[i] = static_cast<int32_t>(i);
+        });
+
+        // then
+        for(size_t i = 0; i < values.size(); ++i) { ASSERT_EQ(values[i], static_cast<int32_t>(i)); }
+    }
+}
+
+TEST(test_Parallel, parallel_for_nested)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(2, mode);
+        std::atomic<int32_t> count{0};
+
+        // when
+        parallel_for(*executor, 0, 64, [&executor, &count](int32_t) {
+            parallel_for(*executor, 0, 64, [&count](int32_t) { count.fetch_add(1); }, 4);
+        }, 1);
+
+        // then
+        ASSERT_EQ(count.load(), 64 * 64);
+    }
+}
+
+TEST(test_Parallel, parallel_for_exception)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+
+        // when & then
+        ASSERT_THROW(parallel_for(*executor, 0, 1000, [](int32_t i) {
+            if(i == 500) { throw std::runtime_error("failed"); }
+        }), std::runtime_error);
+    }
+}
+
+TEST(test_Parallel, parallel_transform)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::vector<int32_t> input(5000);
+        std::iota(input.begin(), input.end(), 0);
+        std::vector<std::string> output(input.size());
+
+        // when
+        auto end = parallel_transform(*executor, input.begin(), input.end(), output.begin(), [](int32_t value) {
+            return std::to_string(value);
+        });
+
+        // then
+        ASSERT_EQ(end, output.end());
+        for(size_t i = 0; i < input.size(); ++i) { ASSERT_EQ(output[i], std::to_string(input[i])); }
+    }
+}
+
+TEST(test_Parallel, parallel_reduce)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::vector<int64_t> values(100000);
+        std::iota(values.begin(), values.end(), 1);
+        std::vector<std::string> words{"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+
+        // when
+        const auto sum = parallel_reduce(*executor, values.begin(), values.end(), int64_t{0});
+        const auto text = parallel_reduce(*executor, words.begin(), words.end(), std::string(">"),
+                                          std::plus<>(), 3);
+        const auto empty = parallel_reduce(*executor, values.begin(), values.begin(), int64_t{7});
+
+        // then
+        ASSERT_EQ(sum, int64_t{100000} * 100001 / 2);
+        ASSERT_EQ(text, ">abcdefghij");
+        ASSERT_EQ(empty, 7);
+    }
+}
+
+TEST(test_Parallel, parallel_invoke)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        int32_t first = 0;
+        int32_t second = 0;
+        int32_t third = 0;
+
+        // when
+        parallel_invoke(*executor,
+                        [&first]() { first = 1; },
+                        [&second]() { second = 2; },
+                        [&third]() { third = 3; });
+
+        // then
+        ASSERT_EQ(first + second + third, 6);
+        ASSERT_THROW(parallel_invoke(*executor,
+                                     []() {},
+                                     []() { throw std::runtime_error("failed"); }), std::runtime_error);
+    }
+}
+
+TEST(test_Parallel, parallel_sort)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::mt19937 random(42);
+        std::vector<uint32_t> values(200000);
+        for(auto& value : values) { value = random(); }
+        auto expected = values;
+        std::sort(expected.begin(), expected.end(), std::greater<>());
+
+        // when
+        parallel_sort(*executor, values.begin(), values.end(), std::greater<>());
+
+        // then
+        ASSERT_EQ(values, expected);
+    }
+}
+} // namespace common::threading::parallel::test
@@ -23,8 +23,10 @@ SOFTWARE.
 **********************************************************************/
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <thread>
 #include <iostream>
+#include <memory>
 
 #include "common/threading/Runnable.hpp"
 
@@ -97,6 +99,115 @@ TEST(test_Runnable, already_running)
     ASSERT_TRUE(exceptionRised);
 }
 
+TEST(test_Runnable, fixed_rate)
+{
+    // given
+    class TestRunnable : public Runnable
+    {
+    public :
+        std::atomic<size_t> _count{0};
+
+    private :
+        auto __work() -> void override { ++_count; }
+    };
+
+    auto runnable = TestRunnable();
+    Runnable::RunPolicy policy;
+    policy._mode = Runnable::RunPolicy::Mode::FIXED_RATE;
+    policy._period = std::chrono::milliseconds(5);
+    runnable.set_run_policy(policy);
+    runnable.set_statistics_enabled(true);
+
+    // when
+    auto future = runnable.run();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    runnable.stop();
+    future.wait();
+    const auto statistics = runnable.get_run_statistics();
+
+    // then
+    ASSERT_EQ(runnable.get_run_policy()._mode, Runnable::RunPolicy::Mode::FIXED_RATE);
+    ASSERT_GE(runnable._count.load(), 10u);
+    ASSERT_LE(runnable._count.load(), 25u);
+    ASSERT_EQ(statistics._iterations, runnable._count.load());
+    ASSERT_EQ(statistics._workTime.count(), statistics._iterations);
+    ASSERT_GE(statistics._interval.percentile(50), 4000000u);
+}
+
+TEST(test_Runnable, event_driven)
+{
+    // given
+    class TestRunnable : public Runnable
+    {
+    public :
+        std::atomic<size_t> _count{0};
+
+    private :
+        auto __work() -> void override { ++_count; }
+    };
+
+    auto runnable = TestRunnable();
+    Runnable::RunPolicy policy;
+    policy._mode = Runnable::RunPolicy::Mode::EVENT_DRIVEN;
+    runnable.set_run_policy(policy);
+
+    // when
+    auto future = runnable.run();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const size_t before = runnable._count.load();
+    for(int i = 0; i < 3; ++i)
+    {
+        runnable.wake();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    const size_t after = runnable._count.load();
+    runnable.stop();
+    future.wait();
+
+    // then
+    ASSERT_EQ(before, 0u);
+    ASSERT_EQ(after, 3u);
+}
+
+TEST(test_Runnable, backoff_when_idle)
+{
+    // given
+    class TestRunnable : public Runnable
+    {
+    public :
+        std::atomic<size_t> _count{0};
+
+    private :
+        auto __work() -> void override
+        {
+            ++_count;
+            report_idle();
+        }
+    };
+
+    auto runnable = TestRunnable();
+    Runnable::RunPolicy policy;
+    policy._mode = Runnable::RunPolicy::Mode::BACKOFF;
+    policy._minBackoff = std::chrono::microseconds(100);
+    policy._maxBackoff = std::chrono::milliseconds(10);
+    runnable.set_run_policy(policy);
+    runnable.set_statistics_enabled(true);
+
+    // when
+    auto future = runnable.run();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    const auto start = std::chrono::steady_clock::now();
+    runnable.stop();
+    future.wait();
+    const auto stopping = std::chrono::steady_clock::now() - start;
+    const auto statistics = runnable.get_run_statistics();
+
+    // then
+    ASSERT_LE(runnable._count.load(), 30u);
+    ASSERT_EQ(statistics._idleIterations, statistics._iterations);
+    ASSERT_LT(stopping, std::chrono::milliseconds(10));
+}
+
 TEST(test_ActiveRunnable, run_with_data_type_and_return_type)
 {
     // given
@@ -320,5 +431,164 @@ TEST(test_ActiveRunnable, already_running)
     ASSERT_EQ(runnable._last, 5);
     ASSERT_TRUE(exceptionRised);
 }
-} // namespace common::threading::test
 
+TEST(test_ActiveRunnable, post_move_only_data)
+{
+    // given
+    class TestRunnable : public ActiveRunnable<std::unique_ptr<int32_t>, void>
+    {
+    public :
+        std::atomic<int32_t> _sum{0};
+
+    private :
+        auto __work(std::unique_ptr<int32_t>&& data) -> void override { _sum += *data; }
+    };
+
+    auto runnable = TestRunnable();
+
+    // when
+    auto future = runnable.run();
+    for(int32_t i = 1; i <= 100; ++i) { ASSERT_TRUE(runnable.post(std::make_unique<int32_t>(i))); }
+    runnable.notify(std::make_unique<int32_t>(0)).wait();
+    runnable.stop();
+    future.wait();
+
+    // then
+    ASSERT_EQ(runnable._sum.load(), 5050);
+}
+
+TEST(test_ActiveRunnable, batch_mode)
+{
+    // given
+    class TestRunnable : public ActiveRunnable<int32_t, void>
+    {
+    public :
+        std::vector<int32_t> _received;
+        size_t _batches = 0;
+
+    private :
+        auto __work(int32_t&& data) -> void override { _received.push_back(data); }
+        auto __work_batch(Span<int32_t> batch) -> void override
+        {
+            ++_batches;
+            _received.insert(_received.end(), batch.begin(), batch.end());
+        }
+    };
+
+    auto runnable = TestRunnable();
+    runnable.set_batch_mode(true);
+
+    // when
+    for(int32_t i = 0; i < 10; ++i) { runnable.post(i); }
+    auto last = runnable.notify(10);
+    auto future = runnable.run();
+    last.wait();
+    runnable.stop();
+    future.wait();
+
+    // then
+    ASSERT_TRUE(runnable.get_batch_mode());
+    ASSERT_EQ(runnable._batches, 1u);
+    ASSERT_EQ(runnable._received, (std::vector<int32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+}
+
+TEST(test_ActiveRunnable, overflow_reject)
+{
+    // given
+    class TestRunnable : public ActiveRunnable<int32_t, int32_t>
+    {
+    private :
+        auto __work(int32_t&& data) -> int32_t override { return data; }
+    };
+
+    auto runnable = TestRunnable();
+    runnable.set_capacity(2, TestRunnable::Overflow::REJECT);
+
+    // when
+    auto first = runnable.notify(1);
+    auto second = runnable.notify(2);
+    auto third = runnable.notify(3);
+    const bool posted = runnable.post(4);
+    const size_t pending = runnable.pending();
+
+    auto future = runnable.run();
+    const int32_t firstValue = first.get();
+    const int32_t secondValue = second.get();
+    runnable.stop();
+    future.wait();
+
+    // then
+    ASSERT_EQ(runnable.get_capacity(), 2u);
+    ASSERT_EQ(runnable.get_overflow(), TestRunnable::Overflow::REJECT);
+    ASSERT_FALSE(posted);
+    ASSERT_EQ(pending, 2u);
+    ASSERT_EQ(firstValue, 1);
+    ASSERT_EQ(secondValue, 2);
+    ASSERT_THROW(third.get(), RuntimeException);
+}
+
+TEST(test_ActiveRunnable, overflow_drop_oldest)
+{
+    // given
+    class TestRunnable : public ActiveRunnable<int32_t, void>
+    {
+    public :
+        std::vector<int32_t> _received;
+
+    private :
+        auto __work(int32_t&& data) -> void override { _received.push_back(data); }
+    };
+
+    auto runnable = TestRunnable();
+    runnable.set_capacity(3, TestRunnable::Overflow::DROP_OLDEST);
+
+    // when
+    auto dropped = runnable.notify(0);
+    for(int32_t i = 1; i < 5; ++i) { runnable.post(i); }
+    auto last = runnable.notify(5);
+    auto future = runnable.run();
+    last.wait();
+    runnable.stop();
+    future.wait();
+
+    // then
+    ASSERT_EQ(runnable._received, (std::vector<int32_t>{3, 4, 5}));
+    ASSERT_THROW(dropped.get(), std::future_error);
+}
+
+TEST(test_ActiveRunnable, overflow_block)
+{
+    // given
+    class TestRunnable : public ActiveRunnable<int32_t, void>
+    {
+    public :
+        std::vector<int32_t> _received;
+
+    private :
+        auto __work(int32_t&& data) -> void override { _received.push_back(data); }
+    };
+
+    auto runnable = TestRunnable();
+    runnable.set_capacity(1, TestRunnable::Overflow::BLOCK);
+    runnable.post(0);
+
+    // when
+    std::atomic<bool> returned{false};
+    std::thread producer([&](){
+        runnable.post(1);
+        returned.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const bool blocked = !returned.load();
+
+    auto future = runnable.run();
+    producer.join();
+    runnable.notify(2).wait();
+    runnable.stop();
+    future.wait();
+
+    // then
+    ASSERT_TRUE(blocked);
+    ASSERT_EQ(runnable._received, (std::vector<int32_t>{0, 1, 2}));
+}
+} // namespace common::threading::test
@@ -0,0 +1,265 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/threading/Strand.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace common::threading::test
+{
+TEST(test_Strand, tasks_never_overlap_and_keep_order)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        auto strand = Strand::create(executor, TaskExecutor::Priority::NORMAL, 4);
+        constexpr size_t PRODUCERS = 4;
+        constexpr size_t COUNT = 2000;
+
+        std::atomic<bool> inside{false};
+        std::atomic<size_t> overlaps{0};
+        std::atomic<size_t> outside{0};
+        std::vector<std::vector<size_t>> received(PRODUCERS);
+
+        // when
+        std::vector<std::thread> producers;
+        for(size_t p = 0; p < PRODUCERS; ++p)
+        {
+            producers.emplace_back([&, p]() {
+                for(size_t i = 0; i < COUNT; ++i)
+                {
+                    strand->post([&, p, i]() {
+                        if(inside.exchange(true)) { overlaps.fetch_add(1); }
+                        if(!strand->running_in_this_thread()) { outside.fetch_add(1); }
+                        received[p].push_back(i);
+                        inside.store(false);
+                    });
+                }
+            });
+        }
+        for(auto& producer : producers) { producer.join(); }
+        auto last = strand->load<size_t>([&]() { return received[0].size(); });
+        const size_t firstCount = last.get();
+
+        // then
+        ASSERT_EQ(overlaps.load(), 0u);
+        ASSERT_EQ(outside.load(), 0u);
+        ASSERT_EQ(firstCount, COUNT);
+        ASSERT_FALSE(strand->running_in_this_thread());
+        for(size_t p = 0; p < PRODUCERS; ++p)
+        {
+            ASSERT_EQ(received[p].size(), COUNT);
+            for(size_t i = 0; i < COUNT; ++i) { ASSERT_EQ(received[p][i], i); }
+        }
+        executor->stop();
+    }
+}
+
+TEST(test_Strand, load_delivers_exception)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    auto strand = Strand::create(executor);
+
+    // when
+    strand->post([]() { throw RuntimeException("ignored"); });
+    auto future = strand->load<int32_t>([]() -> int32_t { throw RuntimeException("failed"); });
+    auto next = strand->load<int32_t>([]() { return 7; });
+
+    // then
+    ASSERT_THROW(future.get(), RuntimeException);
+    ASSERT_EQ(next.get(), 7);
+    executor->stop();
+}
+
+TEST(test_StrandRunnable, many_runnables_share_an_executor)
+{
+    // given
+    class TestRunnable : public StrandRunnable<int32_t, int32_t>
+    {
+    public :
+        using StrandRunnable::StrandRunnable;
+        int32_t _sum = 0;
+        std::atomic<bool> _inside{false};
+        std::atomic<size_t> _overlaps{0};
+
+    private :
+        auto __work(int32_t&& data) -> int32_t override
+        {
+            if(_inside.exchange(true)) { _overlaps.fetch_add(1); }
+            _sum += data;
+            _inside.store(false);
+            return _sum;
+        }
+    };
+
+    auto executor = TaskExecutor::create(4);
+    constexpr size_t RUNNABLES = 200;
+    constexpr int32_t MESSAGES = 100;
+
+    std::vector<std::shared_ptr<TestRunnable>> runnables;
+    for(size_t i = 0; i < RUNNABLES; ++i) { runnables.push_back(TestRunnable::create<TestRunnable>(executor)); }
+
+    // when
+    std::vector<std::future<int32_t>> results;
+    for(int32_t m = 1; m <= MESSAGES; ++m)
+    {
+        for(size_t i = 0; i < RUNNABLES; ++i)
+        {
+            if(m == MESSAGES) { results.push_back(runnables[i]->notify(m)); }
+            else { runnables[i]->post(m); }
+        }
+    }
+
+    // then
+    for(size_t i = 0; i < RUNNABLES; ++i)
+    {
+        ASSERT_EQ(results[i].get(), MESSAGES * (MESSAGES + 1) / 2);
+        ASSERT_EQ(runnables[i]->_overlaps.load(), 0u);
+    }
+    runnables.clear();
+    executor->stop();
+}
+
+TEST(test_StrandRunnable, move_only_data_and_exceptions)
+{
+    // given
+    class TestRunnable : public StrandRunnable<std::unique_ptr<int32_t>, int32_t>
+    {
+    public :
+        using StrandRunnable::StrandRunnable;
+
+    private :
+        auto __work(std::unique_ptr<int32_t>&& data) -> int32_t override
+        {
+            if(!data) { throw BadHandlingException("empty"); }
+            return *data * 2;
+        }
+    };
+
+    auto executor = TaskExecutor::create(2);
+    auto runnable = TestRunnable::create<TestRunnable>(executor);
+
+    // when
+    auto doubled = runnable->notify(std::make_unique<int32_t>(21));
+    auto failed = runnable->notify(nullptr);
+
+    // then
+    ASSERT_EQ(doubled.get(), 42);
+    ASSERT_THROW(failed.get(), BadHandlingException);
+    runnable.reset();
+    executor->stop();
+}
+
+TEST(test_StrandRunnable, stop_drops_pending_messages)
+{
+    // given
+    class TestRunnable : public StrandRunnable<void, void>
+    {
+    public :
+        using StrandRunnable::StrandRunnable;
+        std::atomic<size_t> _count{0};
+
+    private :
+        auto __work() -> void override { ++_count; }
+    };
+
+    auto executor = TaskExecutor::create(1);
+    auto strand = Strand::create(executor);
+    auto runnable = TestRunnable::create<TestRunnable>(strand);
+
+    std::promise<void> gate;
+    auto opened = gate.get_future().share();
+    strand->post([opened]() { opened.wait(); });
+
+    // when
+    auto pending = runnable->notify();
+    runnable->stop();
+    const bool accepted = runnable->post();
+    gate.set_value();
+
+    // then
+    ASSERT_FALSE(accepted);
+    ASSERT_FALSE(runnable->status());
+    ASSERT_THROW(pending.get(), std::future_error);
+    ASSERT_EQ(runnable->_count.load(), 0u);
+    executor->stop();
+}
+
+TEST(test_StrandRunnable, destroy_with_queued_messages)
+{
+    // given
+    class TestRunnable : public StrandRunnable<int32_t, void>
+    {
+    private :
+        std::atomic<bool>& _destroyed;
+        std::atomic<bool>& _late;
+
+    public :
+        std::atomic<bool> _started{false};
+
+        TestRunnable(Passkey key, std::shared_ptr<TaskExecutor> executor, std::atomic<bool>& destroyed, std::atomic<bool>& late)
+            : StrandRunnable(key, std::move(executor)), _destroyed(destroyed), _late(late) {}
+        ~TestRunnable() override { _destroyed.store(true); }
+
+    private :
+        auto __work([[maybe_unused]] int32_t&& data) -> void override
+        {
+            _started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if(_destroyed.load()) { _late.store(true); }
+        }
+    };
+
+    std::atomic<bool> destroyed{false};
+    std::atomic<bool> late{false};
+    auto executor = TaskExecutor::create(2);
+    auto runnable = TestRunnable::create<TestRunnable>(executor, destroyed, late);
+    std::vector<std::future<void>> results;
+    for(int32_t i = 0; i < 100; ++i) { results.push_back(runnable->notify(i)); }
+    while(!runnable->_started.load()) { std::this_thread::yield(); }
+
+    // when
+    runnable.reset();
+
+    // then
+    size_t handled = 0;
+    for(auto& result : results)
+    {
+        try { result.get(); ++handled; }
+        catch(const std::future_error&) {}
+    }
+    ASSERT_FALSE(late.load());
+    ASSERT_LT(handled, results.size());
+    executor->stop();
+}
+} // namespace common::threading::test
@@ -0,0 +1,127 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/threading/Task.hpp"
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+
+namespace common::threading::test
+{
+TEST(test_Task, invoke_inline)
+{
+    // given
+    int32_t value = 0;
+    Task task([&value]() { value = 42; });
+
+    // when
+    ASSERT_TRUE(static_cast<bool>(task));
+    task();
+
+    // then
+    ASSERT_EQ(value, 42);
+}
+
+TEST(test_Task, invoke_pooled)
+{
+    // given
+    std::array<uint8_t, Task::INLINE_SIZE * 2> payload{};
+    payload.back() = 7;
+    int32_t value = 0;
+    Task task([&value, payload]() { value = payload.back(); });
+
+    // when
+    Task moved(std::move(task));
+    moved();
+
+    // then
+    ASSERT_FALSE(static_cast<bool>(task));
+    ASSERT_EQ(value, 7);
+}
+
+TEST(test_Task, move_only_callable)
+{
+    // given
+    auto owned = std::make_unique<int32_t>(5);
+    int32_t value = 0;
+    Task task([&value, owned = std::move(owned)]() { value = *owned; });
+
+    // when
+    Task assigned;
+    assigned = std::move(task);
+    assigned();
+    assigned.reset();
+
+    // then
+    ASSERT_EQ(value, 5);
+    ASSERT_FALSE(static_cast<bool>(assigned));
+}
+
+TEST(test_Task, destroys_callable)
+{
+    // given
+    auto counter = std::make_shared<int32_t>(0);
+    std::weak_ptr<int32_t> weak = counter;
+
+    // when
+    {
+        Task task([counter = std::move(counter)]() {});
+        ASSERT_FALSE(weak.expired());
+    }
+
+    // then
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(test_Task, make_task)
+{
+    // given
+    auto [task, future] = make_task<int32_t>([]() { return 42; });
+    auto [failing, failingFuture] = make_task<void>([]() { throw std::runtime_error("failed"); });
+
+    // when
+    task();
+    failing();
+
+    // then
+    ASSERT_EQ(future.get(), 42);
+    ASSERT_THROW(failingFuture.get(), std::runtime_error);
+}
+
+TEST(test_Task, make_task_broken_promise)
+{
+    // given
+    std::future<int32_t> future;
+    {
+        auto [task, taskFuture] = make_task<int32_t>([]() { return 42; });
+        future = std::move(taskFuture);
+    }
+
+    // then
+    ASSERT_THROW(future.get(), std::future_error);
+}
+} // namespace common::threading::test
@@ -23,6 +23,8 @@ SOFTWARE.
 **********************************************************************/
 
 #include "common/threading/TaskExecutor.hpp"
+#include "common/threading/Topology.hpp"
+#include "AllocationCounter.hpp"
 
 #include <gtest/gtest.h>
 
@@ -30,7 +32,12 @@ SOFTWARE.
 #include <array>
 #include <chrono>
 #include <climits>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 namespace common::threading::test
 {
@@ -214,4 +221,571 @@ TEST(test_TaskExecutor, WorkStealing)
     
     executor->stop();
 }
+
+TEST(test_TaskExecutor, LockFreeLoadWithMultiTypesReturn)
+{
+    // given
+    auto executor = TaskExecutor::create(4, TaskExecutor::Mode::LOCK_FREE);
+
+    // when
+    auto future_int32_t = executor->load<int32_t>([]() { return 42; });
+    auto future_void = executor->load<void>([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    });
+    auto future_string = executor->load<std::string>([]() {
+        return std::string("Hello, World!");
+    });
+
+    // then
+    ASSERT_EQ(executor->get_mode(), TaskExecutor::Mode::LOCK_FREE);
+    ASSERT_EQ(future_int32_t.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_EQ(future_int32_t.get(), 42);
+    ASSERT_EQ(future_void.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_NO_THROW(future_void.get());
+    ASSERT_EQ(future_string.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_EQ(future_string.get(), "Hello, World!");
+
+    executor->stop();
+}
+
+TEST(test_TaskExecutor, LockFreeForkJoin)
+{
+    // given
+    auto executor = TaskExecutor::create(4, TaskExecutor::Mode::LOCK_FREE);
+    constexpr int32_t depth = 12;
+    constexpr int32_t leaves = 1 << depth;
+    std::atomic<int32_t> leafCount{0};
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+
+    // when
+    std::function<void(int32_t)> fork = [&](int32_t level) {
+        if(level == depth)
+        {
+            if(leafCount.fetch_add(1) + 1 == leaves) { done.set_value(); }
+            return;
+        }
+        executor->load<void>([&fork, level]() { fork(level + 1); });
+        executor->load<void>([&fork, level]() { fork(level + 1); });
+    };
+    executor->load<void>([&fork]() { fork(0); });
+
+    // then
+    ASSERT_EQ(doneFuture.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    ASSERT_EQ(leafCount.load(), leaves);
+
+    executor->stop();
+}
+
+TEST(test_TaskExecutor, LockFreeWorkStealing)
+{
+    // given
+    auto executor = TaskExecutor::create(4, TaskExecutor::Mode::LOCK_FREE);
+    const int32_t totalTasks = 200;
+    std::vector<std::future<int32_t>> futures;
+    std::atomic<int32_t> taskCounter{0};
+
+    // when
+    auto root = executor->load<void>([&executor, &futures, &taskCounter, totalTasks]() {
+        // every task lands on the deque of this worker and has to be stolen by the others
+        for(int32_t i = 0; i < totalTasks; ++i)
+        {
+            futures.push_back(executor->load<int32_t>([&taskCounter]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                return taskCounter.fetch_add(1);
+            }));
+        }
+    });
+    ASSERT_EQ(root.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // then
+    std::set<int32_t> results;
+    for(auto& future : futures)
+    {
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        results.insert(future.get());
+    }
+    ASSERT_EQ(results.size(), totalTasks);
+    ASSERT_EQ(*results.begin(), 0);
+    ASSERT_EQ(*results.rbegin(), totalTasks - 1);
+
+    executor->stop();
+}
+
+TEST(test_TaskExecutor, LockFreeStopWithPendingTasks)
+{
+    // given
+    auto executor = TaskExecutor::create(2, TaskExecutor::Mode::LOCK_FREE);
+    std::atomic<int32_t> executed{0};
+
+    // when
+    for(int32_t i = 0; i < 100; ++i)
+    {
+        executor->load<void>([&executed]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            executed.fetch_add(1);
+        });
+    }
+    executor->stop();
+    const auto executedAtStop = executed.load();
+    executor.reset();
+
+    // then
+    ASSERT_LE(executedAtStop, 100);
+    ASSERT_EQ(executed.load(), executedAtStop);
+}
+
+TEST(test_TaskExecutor, Post)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::atomic<int32_t> executed{0};
+
+        // when
+        for(int32_t i = 0; i < 1000; ++i)
+        {
+            executor->post([&executed]() { executed.fetch_add(1); });
+        }
+        executor->post([]() { throw std::runtime_error("ignored"); });
+
+        // then
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(executed.load() < 1000 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_EQ(executed.load(), 1000);
+        ASSERT_EQ(executor->load<int32_t>([]() { return 1; }).get(), 1);
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, LoadBulk)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::vector<std::function<int32_t()>> tasks;
+        for(int32_t i = 0; i < 1000; ++i)
+        {
+            tasks.push_back([i]() { return i * 2; });
+        }
+
+        // when
+        auto futures = executor->load_bulk<int32_t>(tasks);
+        auto empty = executor->load_bulk<int32_t>(std::vector<std::function<int32_t()>>());
+
+        // then
+        ASSERT_EQ(futures.size(), tasks.size());
+        ASSERT_TRUE(empty.empty());
+        for(int32_t i = 0; i < 1000; ++i) { ASSERT_EQ(futures[i].get(), i * 2); }
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, PostBulkFromWorker)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::atomic<int32_t> executed{0};
+
+        // when
+        executor->load<void>([&executor, &executed]() {
+            std::vector<std::function<void()>> tasks(1000, [&executed]() { executed.fetch_add(1); });
+            executor->post_bulk(std::move(tasks));
+        }).get();
+
+        // then
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(executed.load() < 1000 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_EQ(executed.load(), 1000);
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, PriorityLanes)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(1, mode);
+        std::promise<void> gate;
+        auto opened = gate.get_future().share();
+        std::atomic<bool> blocked{false};
+        executor->post([opened, &blocked]() {
+            blocked.store(true);
+            opened.wait();
+        });
+        while(!blocked.load()) { std::this_thread::yield(); }
+
+        std::mutex lock;
+        std::vector<int32_t> order;
+        auto record = [&lock, &order](int32_t value) {
+            return [&lock, &order, value]() {
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(value);
+            };
+        };
+
+        // when
+        executor->post(record(3), TaskExecutor::Priority::BACKGROUND);
+        executor->post(record(2), TaskExecutor::Priority::NORMAL);
+        executor->post(record(1), TaskExecutor::Priority::REAL_TIME);
+        auto last = executor->load<void>([]() {}, TaskExecutor::Priority::BACKGROUND);
+        gate.set_value();
+        last.wait();
+
+        // then
+        ASSERT_EQ(order, (std::vector<int32_t>{1, 2, 3}));
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, EarliestDeadlineFirst)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(1, mode);
+        executor->set_statistics_enabled(true);
+        std::promise<void> gate;
+        auto opened = gate.get_future().share();
+        std::atomic<bool> blocked{false};
+        executor->post([opened, &blocked]() {
+            blocked.store(true);
+            opened.wait();
+        });
+        while(!blocked.load()) { std::this_thread::yield(); }
+
+        std::mutex lock;
+        std::vector<int32_t> order;
+        auto record = [&lock, &order](int32_t value) {
+            return [&lock, &order, value]() {
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(value);
+                return value;
+            };
+        };
+        const auto now = std::chrono::steady_clock::now();
+
+        // when
+        executor->post(record(4));
+        executor->post_by(now + std::chrono::seconds(3), record(3));
+        auto first = executor->load_by<int32_t>(now - std::chrono::seconds(1), record(1));
+        executor->post_by(now + std::chrono::seconds(2), record(2));
+        auto last = executor->load<void>([]() {}, TaskExecutor::Priority::BACKGROUND);
+        gate.set_value();
+        last.wait();
+
+        // then
+        ASSERT_EQ(first.get(), 1);
+        ASSERT_EQ(order, (std::vector<int32_t>{1, 2, 3, 4}));
+        const auto statistics = executor->get_deadline_statistics();
+        ASSERT_EQ(statistics._count, 3);
+        ASSERT_EQ(statistics._missedDeadlines, 1);
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, QueueStatistics)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(2, mode);
+        executor->post([]() {});
+        executor->set_statistics_enabled(true);
+
+        // when
+        std::vector<std::future<void>> futures;
+        for(int32_t i = 0; i < 10; ++i)
+        {
+            futures.push_back(executor->load<void>([]() {}, TaskExecutor::Priority::REAL_TIME));
+            futures.push_back(executor->load<void>([]() {}, TaskExecutor::Priority::BACKGROUND));
+        }
+        auto bulk = executor->load_bulk<void>(std::vector<std::function<void()>>(5, []() {}));
+        for(auto& future : futures) { future.wait(); }
+        for(auto& future : bulk) { future.wait(); }
+
+        // then
+        const auto realTime = executor->get_statistics(TaskExecutor::Priority::REAL_TIME);
+        ASSERT_EQ(realTime._count, 10);
+        ASSERT_GE(realTime._maxDelay, realTime.mean());
+        ASSERT_EQ(executor->get_statistics(TaskExecutor::Priority::BACKGROUND)._count, 10);
+        ASSERT_EQ(executor->get_statistics(TaskExecutor::Priority::NORMAL)._count, 5);
+
+        executor->reset_statistics();
+        ASSERT_EQ(executor->get_statistics(TaskExecutor::Priority::REAL_TIME)._count, 0);
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, LoadAllocationCount)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        constexpr size_t rounds = 100;
+        constexpr size_t tasksPerRound = 256;
+        std::vector<std::future<int32_t>> futures;
+        futures.reserve(tasksPerRound);
+        int64_t sum = 0;
+
+        auto submit = [&executor, &futures, &sum]() {
+            for(size_t round = 0; round < rounds; ++round)
+            {
+                for(size_t i = 0; i < tasksPerRound; ++i)
+                {
+                    futures.push_back(executor->load<int32_t>([&sum, i]() {
+                        return static_cast<int32_t>(i + (sum & 1));
+                    }));
+                }
+                for(auto& future : futures) { sum += future.get(); }
+                futures.clear();
+            }
+        };
+        submit(); // warm up queues and pools
+
+        // when
+        common::test::AllocationCounter::start();
+        const auto begin = std::chrono::steady_clock::now();
+        submit();
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        const auto allocations = common::test::AllocationCounter::stop();
+
+        // then
+        const auto tasks = rounds * tasksPerRound;
+        std::cout << "mode " << static_cast<int32_t>(mode) << ": "
+                  << static_cast<double>(allocations) / tasks << " allocations/task, "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / tasks << " ns/task" << std::endl;
+        ASSERT_LE(allocations, tasks / 100);
+
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, Placement)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        for(auto placement : {TaskExecutor::Placement::CORE, TaskExecutor::Placement::NUMA_NODE})
+        {
+            // given
+            auto executor = TaskExecutor::create(4, mode, placement);
+            const auto nodes = get_numa_nodes();
+            std::atomic<int32_t> sum{0};
+
+            // when
+            std::vector<std::future<void>> futures;
+            for(int32_t i = 0; i < 1000; ++i)
+            {
+                futures.push_back(executor->load<void>([&sum, i]() { sum.fetch_add(i); }));
+            }
+            for(auto& future : futures) { future.get(); }
+
+            // then
+            ASSERT_EQ(executor->get_placement(), placement);
+            ASSERT_EQ(sum.load(), 499500);
+            for(uint32_t i = 0; i < executor->get_thread_count(); ++i)
+            {
+                const auto node = executor->get_node(i);
+                ASSERT_TRUE(std::any_of(nodes.begin(), nodes.end(), [node](const NumaNode& n) { return n._id == node; }));
+            }
+            // Workers are handed out node by node
+            for(uint32_t i = 1; i < executor->get_thread_count(); ++i)
+            {
+                ASSERT_LE(executor->get_node(i - 1), executor->get_node(i));
+            }
+
+            executor->stop();
+        }
+    }
+}
+
+TEST(test_TaskExecutor, IdlePolicy)
+{
+    using Strategy = TaskExecutor::IdlePolicy::Strategy;
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        for(auto strategy : {Strategy::PARK, Strategy::SPIN, Strategy::ADAPTIVE, Strategy::BUSY_POLL})
+        {
+            // given
+            auto executor = TaskExecutor::create(2, mode);
+            TaskExecutor::IdlePolicy policy;
+            policy._strategy = strategy;
+            policy._spin = std::chrono::microseconds(50);
+            policy._yield = std::chrono::microseconds(50);
+            executor->set_idle_policy(policy);
+            executor->set_telemetry_enabled(true);
+            // Parks decided under the default policy before the change must not count
+            executor->load<void>([]() {}).get();
+            executor->reset_telemetry();
+            constexpr int32_t count = 200;
+            int64_t latency = 0;
+
+            // when
+            for(int32_t i = 0; i < count; ++i)
+            {
+                const auto submitted = std::chrono::steady_clock::now();
+                auto started = executor->load<std::chrono::steady_clock::time_point>([]() {
+                    return std::chrono::steady_clock::now();
+                }).get();
+                latency += std::chrono::duration_cast<std::chrono::nanoseconds>(started - submitted).count();
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+            }
+
+            // then
+            const auto current = executor->get_idle_policy();
+            TaskExecutor::WorkerTelemetry total;
+            for(const auto& worker : executor->get_telemetry()) { total.merge(worker); }
+            std::cout << "mode " << static_cast<int32_t>(mode) << ", strategy " << static_cast<int32_t>(strategy)
+                      << ": " << latency / count << " ns wake-up latency, " << total._parks << " parks" << std::endl;
+            ASSERT_EQ(current._strategy, strategy);
+            ASSERT_EQ(current._spin, policy._spin);
+            ASSERT_EQ(current._yield, policy._yield);
+            // A parking worker blocks after nearly every task, a polling one never does
+            if(strategy == Strategy::PARK) { ASSERT_GE(total._parks, static_cast<uint64_t>(count / 2)); }
+            if(strategy == Strategy::BUSY_POLL) { ASSERT_EQ(total._parks, 0u); }
+
+            executor->stop();
+        }
+    }
+}
+
+TEST(test_TaskExecutor, ElasticCompensatesBlockedWorkers)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(2, mode);
+        TaskExecutor::Elasticity elasticity;
+        elasticity._maxThreads = 4;
+        elasticity._blockedAfter = std::chrono::milliseconds(5);
+        elasticity._idleTimeout = std::chrono::milliseconds(20);
+        executor->set_elasticity(elasticity);
+
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::atomic<int32_t> blocking{0};
+        for(int32_t i = 0; i < 2; ++i)
+        {
+            executor->post([released, &blocking]() {
+                blocking.fetch_add(1);
+                released.wait();
+            });
+        }
+        while(blocking.load() < 2) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+
+        // when
+        auto future = executor->load<int32_t>([]() { return 42; });
+        const auto status = future.wait_for(std::chrono::seconds(5));
+        const auto helpers = executor->get_helper_count();
+        release.set_value();
+
+        // then
+        ASSERT_EQ(status, std::future_status::ready);
+        ASSERT_EQ(future.get(), 42);
+        ASSERT_GT(helpers, 0u);
+        ASSERT_LE(helpers, 2u);
+
+        // Helpers retire once the pool is idle again
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(executor->get_helper_count() > 0 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ASSERT_EQ(executor->get_helper_count(), 0u);
+
+        executor->stop();
+    }
+}
+
+TEST(test_TaskExecutor, ElasticGrowsUnderLoad)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(1, mode);
+        TaskExecutor::Elasticity elasticity;
+        elasticity._maxThreads = 4;
+        elasticity._queueDepth = 4;
+        executor->set_elasticity(elasticity);
+        std::atomic<int32_t> done{0};
+
+        // when
+        std::vector<std::future<void>> futures;
+        for(int32_t i = 0; i < 200; ++i)
+        {
+            futures.push_back(executor->load<void>([&done]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                done.fetch_add(1);
+            }));
+        }
+        for(auto& future : futures) { future.get(); }
+        const auto helpers = executor->get_helper_count(); // helpers stay until they idle for 100ms
+
+        // then
+        ASSERT_EQ(done.load(), 200);
+        ASSERT_GT(helpers, 0u);
+        ASSERT_LE(helpers, 3u);
+        ASSERT_EQ(executor->get_elasticity()._maxThreads, 4u);
+
+        executor->stop();
+        ASSERT_EQ(executor->get_helper_count(), 0u);
+    }
+}
+
+TEST(test_TaskExecutor, Telemetry)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(2, mode);
+        executor->set_telemetry_enabled(true);
+        constexpr uint64_t count = 200;
+
+        // when
+        std::vector<std::future<void>> futures;
+        for(uint64_t i = 0; i < count; ++i)
+        {
+            futures.push_back(executor->load<void>([]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }));
+        }
+        for(auto& future : futures) { future.get(); }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        const auto telemetry = executor->get_telemetry();
+        TaskExecutor::WorkerTelemetry total;
+        for(const auto& worker : telemetry) { total.merge(worker); }
+
+        executor->reset_telemetry();
+        TaskExecutor::WorkerTelemetry cleared;
+        for(const auto& worker : executor->get_telemetry()) { cleared.merge(worker); }
+
+        // then
+        ASSERT_EQ(telemetry.size(), executor->get_thread_count() + 1);
+        ASSERT_EQ(total._tasks, count);
+        ASSERT_EQ(total._waitTime.count(), count);
+        ASSERT_EQ(total._runTime.count(), count);
+        ASSERT_GE(total._runTime.percentile(50.0), 100000u);
+        ASSERT_LE(total._steals, total._stealAttempts);
+        ASSERT_GT(total._parks, 0u);
+        ASSERT_GT(total._idleTime.count(), 0);
+        ASSERT_EQ(total._queueDepth, 0u);
+        ASSERT_EQ(cleared._tasks, 0u);
+        ASSERT_EQ(cleared._runTime.count(), 0u);
+
+        executor->stop();
+    }
+}
 } // namespace common::threading::test
\ No newline at end of file
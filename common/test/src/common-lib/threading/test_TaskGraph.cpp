@@ -0,0 +1,123 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/threading/TaskGraph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace common::threading::test
+{
+TEST(test_TaskGraph, diamond)
+{
+    for(auto mode : {TaskExecutor::Mode::LOCKED, TaskExecutor::Mode::LOCK_FREE})
+    {
+        // given
+        auto executor = TaskExecutor::create(4, mode);
+        std::mutex lock;
+        std::vector<char> order;
+        auto record = [&lock, &order](char name) {
+            return [&lock, &order, name]() {
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(name);
+            };
+        };
+
+        TaskGraph graph;
+        auto a = graph.emplace(record('a'));
+        auto b = graph.emplace(record('b'));
+        auto c = graph.emplace(record('c'));
+        auto d = graph.emplace(record('d'));
+        graph.precede(a, b);
+        graph.precede(a, c);
+        graph.precede(b, d);
+        graph.precede(c, d);
+
+        // when
+        graph.run(*executor).get();
+
+        // then
+        ASSERT_EQ(order.size(), 4);
+        ASSERT_EQ(order.front(), 'a');
+        ASSERT_EQ(order.back(), 'd');
+    }
+}
+
+TEST(test_TaskGraph, run_twice)
+{
+    // given
+    auto executor = TaskExecutor::create(4, TaskExecutor::Mode::LOCK_FREE);
+    std::atomic<int32_t> count{0};
+    TaskGraph graph;
+    auto root = graph.emplace([&count]() { count.fetch_add(1); });
+    for(int32_t i = 0; i < 100; ++i)
+    {
+        graph.precede(root, graph.emplace([&count]() { count.fetch_add(1); }));
+    }
+
+    // when
+    auto first = graph.run(*executor);
+    auto second = graph.run(*executor);
+    first.get();
+    second.get();
+
+    // then
+    ASSERT_EQ(count.load(), 202);
+}
+
+TEST(test_TaskGraph, exception_skips_successors)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    std::atomic<bool> called{false};
+    TaskGraph graph;
+    auto failing = graph.emplace([]() { throw std::runtime_error("failed"); });
+    auto successor = graph.emplace([&called]() { called.store(true); });
+    graph.precede(failing, successor);
+
+    // when & then
+    ASSERT_THROW(graph.run(*executor).get(), std::runtime_error);
+    ASSERT_FALSE(called.load());
+}
+
+TEST(test_TaskGraph, invalid_graph)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    TaskGraph graph;
+    auto a = graph.emplace([]() {});
+    auto b = graph.emplace([]() {});
+    graph.precede(a, b);
+    graph.precede(b, a);
+
+    // when & then
+    ASSERT_THROW(graph.precede(a, 5), OutOfRangeException);
+    ASSERT_THROW(graph.run(*executor), BadHandlingException);
+    ASSERT_NO_THROW(TaskGraph().run(*executor).get());
+}
+} // namespace common::threading::test
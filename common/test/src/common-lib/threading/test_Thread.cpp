@@ -23,9 +23,17 @@ SOFTWARE.
 **********************************************************************/
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <thread>
+#include <vector>
+
+#if defined(LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "common/threading/Thread.hpp"
+#include "common/threading/Topology.hpp"
 #include "common/Exception.hpp"
 
 namespace common::threading::test
@@ -201,4 +209,332 @@ TEST(test_Thread, async)
     // then
     ASSERT_TRUE(value.load());
 }
-} // namespace common::threading::test
\ No newline at end of file
+
+TEST(test_Thread, set_affinity_before_start)
+{
+    // given
+    int32_t cpu = -1;
+    auto t = Thread::create();
+
+    // when
+    ASSERT_TRUE(t->set_affinity({0}));
+    auto future = t->start([&cpu](){
+#if defined(LINUX)
+        cpu = sched_getcpu();
+#else
+        cpu = 0;
+#endif
+    });
+    future.wait();
+
+    // then
+    ASSERT_EQ(cpu, 0);
+    ASSERT_EQ(t->get_affinity(), std::vector<uint32_t>{0});
+}
+
+TEST(test_Thread, set_affinity_after_start)
+{
+    // given
+    std::atomic<bool> pinned{false};
+    std::atomic<int32_t> cpu{-1};
+    auto t = Thread::create();
+    auto future = t->start([&pinned, &cpu](){
+        while(!pinned.load()) 
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::this_thread::yield();
+#if defined(LINUX)
+        cpu.store(sched_getcpu());
+#else
+        cpu.store(0);
+#endif
+    });
+
+    // when
+    const bool result = t->set_affinity({0});
+    pinned.store(true);
+    future.wait();
+
+    // then
+    ASSERT_TRUE(result);
+    ASSERT_EQ(cpu.load(), 0);
+}
+
+TEST(test_Thread, config_report)
+{
+    // given
+    constexpr size_t STACK_SIZE = 4 * 1024 * 1024;
+    size_t stackSize = 0;
+    int32_t cpu = -1;
+    auto t = Thread::create();
+    Thread::Config config;
+    config._affinity = {0};
+    config._stackSize = STACK_SIZE;
+    config._prefaultStack = 1024 * 1024;
+
+    // when
+    t->set_config(config);
+    auto future = t->start([&stackSize, &cpu](){
+#if defined(LINUX)
+        pthread_attr_t attr;
+        pthread_getattr_np(pthread_self(), &attr);
+        pthread_attr_getstacksize(&attr, &stackSize);
+        pthread_attr_destroy(&attr);
+        cpu = sched_getcpu();
+#else
+        stackSize = STACK_SIZE;
+        cpu = 0;
+#endif
+    });
+    future.wait();
+    const auto report = t->get_report();
+
+    // then
+    ASSERT_EQ(report._affinity, Thread::Outcome::APPLIED);
+    ASSERT_EQ(report._cpus, std::vector<uint32_t>{0});
+    ASSERT_EQ(report._prefaultStack, Thread::Outcome::APPLIED);
+    ASSERT_EQ(report._priority, Thread::Outcome::NOT_REQUESTED);
+    ASSERT_EQ(report._lockMemory, Thread::Outcome::NOT_REQUESTED);
+    ASSERT_EQ(report._isolatedCore, Thread::Outcome::NOT_REQUESTED);
+#if defined(LINUX)
+    ASSERT_EQ(report._stackSize, Thread::Outcome::APPLIED);
+    ASSERT_TRUE(report.succeeded());
+#endif
+    ASSERT_GE(stackSize, STACK_SIZE);
+    ASSERT_EQ(cpu, 0);
+    ASSERT_EQ(t->get_affinity(), std::vector<uint32_t>{0});
+}
+
+TEST(test_Thread, config_priority)
+{
+    // given
+    int32_t policy = -1;
+    auto t = Thread::create();
+    Thread::Config config;
+#if defined(WIN32)
+    config._priority = Thread::Policies::ABOVE_NORMAL;
+#elif defined(LINUX)
+    config._priority = {Thread::Policies::RR, 10};
+#endif
+
+    // when
+    t->set_config(config);
+    auto future = t->start([&policy](){
+#if defined(LINUX)
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &policy, &param);
+#endif
+    });
+    future.wait();
+    const auto report = t->get_report();
+
+    // then
+    ASSERT_NE(report._priority, Thread::Outcome::NOT_REQUESTED);
+    ASSERT_TRUE(t->get_priority() == config._priority);
+#if defined(LINUX)
+    // Without CAP_SYS_NICE the request is refused, but it must reach the right thread
+    if(report._priority == Thread::Outcome::APPLIED) { ASSERT_EQ(policy, SCHED_RR); }
+    else { ASSERT_EQ(policy, SCHED_OTHER); }
+#endif
+}
+
+TEST(test_Thread, config_isolated_core)
+{
+    // given
+    int32_t cpu = -1;
+    const auto isolated = get_isolated_cpus();
+    auto t = Thread::create();
+    Thread::Config config;
+    config._isolatedCore = true;
+
+    // when
+    t->set_config(config);
+    auto future = t->start([&cpu](){
+#if defined(LINUX)
+        cpu = sched_getcpu();
+#endif
+    });
+    future.wait();
+    const auto report = t->get_report();
+
+    // then
+    if(isolated.empty())
+    {
+        ASSERT_EQ(report._isolatedCore, Thread::Outcome::FAILED);
+        ASSERT_FALSE(report.succeeded());
+    }
+    else
+    {
+        ASSERT_EQ(report._isolatedCore, Thread::Outcome::APPLIED);
+        ASSERT_EQ(report._cpus.size(), 1);
+        ASSERT_TRUE(std::find(isolated.begin(), isolated.end(), report._cpus[0]) != isolated.end());
+#if defined(LINUX)
+        ASSERT_EQ(static_cast<uint32_t>(cpu), report._cpus[0]);
+#endif
+    }
+}
+
+TEST(test_Thread, config_while_running)
+{
+    // given
+    std::atomic<bool> running{true};
+    auto t = Thread::create();
+    auto future = t->start([&running](){
+        while(running.load()) 
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+
+    // when
+    bool catched = false;
+    try { t->set_config(Thread::Config()); }
+    catch([[maybe_unused]] AlreadyRunningException& e) { catched = true; }
+    running.store(false);
+    future.wait();
+
+    // then
+    ASSERT_TRUE(catched);
+}
+
+TEST(test_Thread, async_reuses_threads)
+{
+    // given
+    constexpr uint32_t CALLS = 100;
+    std::vector<std::thread::id> ids;
+
+    // when
+    for(uint32_t i = 0; i < CALLS; ++i)
+    {
+        std::thread::id id;
+        Thread::async([&id](){ id = std::this_thread::get_id(); }).wait();
+        ids.push_back(id);
+        // Give the thread time to park again
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    // then
+    ASSERT_LT(ids.size(), CALLS / 10);
+}
+
+TEST(test_Thread, async_runs_concurrently)
+{
+    // given
+    constexpr uint32_t CALLS = 16;
+    std::atomic<uint32_t> arrived{0};
+    std::vector<std::future<void>> futures;
+
+    // when
+    for(uint32_t i = 0; i < CALLS; ++i)
+    {
+        // Every call waits for all others, so they must run at the same time
+        futures.push_back(Thread::async([&arrived](){
+            ++arrived;
+            while(arrived.load() < CALLS) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }));
+    }
+
+    // then
+    for(auto& future : futures) { ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready); }
+}
+
+TEST(test_Thread, async_resets_thread)
+{
+    // given
+    std::string name;
+    int32_t policy = -1;
+
+    // when
+    Thread::async([](){
+#if defined(LINUX)
+        pthread_setname_np(pthread_self(), "renamed");
+        sched_param param;
+        param.sched_priority = 0;
+        pthread_setschedparam(pthread_self(), SCHED_BATCH, &param);
+#endif
+    }).wait();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    Thread::async([&name, &policy](){
+#if defined(LINUX)
+        char buffer[16] = {0};
+        pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+        name = buffer;
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &policy, &param);
+#endif
+    }).wait();
+
+    // then
+#if defined(LINUX)
+    ASSERT_NE(name, "renamed");
+    ASSERT_EQ(policy, SCHED_OTHER);
+#endif
+}
+
+TEST(test_Thread, async_inherits_caller_setup)
+{
+#if defined(LINUX)
+    // given
+    cpu_set_t all;
+    CPU_ZERO(&all);
+    sched_getaffinity(0, sizeof(all), &all);
+
+    int32_t callerPolicy = -1;
+    int32_t callerCount = 0;
+    int32_t otherPolicy = -1;
+    int32_t otherCount = 0;
+    std::thread caller([&callerPolicy, &callerCount](){
+        // Pin to the first allowed cpu and lower the policy, neither needs privileges
+        cpu_set_t one;
+        CPU_ZERO(&one);
+        sched_getaffinity(0, sizeof(one), &one);
+        for(int32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if(CPU_ISSET(cpu, &one)) { CPU_ZERO(&one); CPU_SET(cpu, &one); break; }
+        }
+        pthread_setaffinity_np(pthread_self(), sizeof(one), &one);
+        sched_param param;
+        param.sched_priority = 0;
+        pthread_setschedparam(pthread_self(), SCHED_BATCH, &param);
+
+        Thread::async([&callerPolicy, &callerCount](){
+            cpu_set_t set;
+            sched_getaffinity(0, sizeof(set), &set);
+            callerCount = CPU_COUNT(&set);
+            sched_param param;
+            pthread_getschedparam(pthread_self(), &callerPolicy, &param);
+        }).wait();
+    });
+    caller.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // when
+    Thread::async([&otherPolicy, &otherCount](){
+        cpu_set_t set;
+        sched_getaffinity(0, sizeof(set), &set);
+        otherCount = CPU_COUNT(&set);
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &otherPolicy, &param);
+    }).wait();
+
+    // then
+    ASSERT_EQ(callerCount, 1);
+    ASSERT_EQ(callerPolicy, SCHED_BATCH);
+    ASSERT_EQ(otherCount, CPU_COUNT(&all));
+    ASSERT_EQ(otherPolicy, SCHED_OTHER);
+#endif
+}
+
+TEST(test_Thread, async_exception)
+{
+    // given
+    auto future = Thread::async([](){ throw RuntimeException("failed"); });
+
+    // when
+    bool catched = false;
+    try { future.get(); }
+    catch([[maybe_unused]] RuntimeException& e) { catched = true; }
+
+    // then
+    ASSERT_TRUE(catched);
+}
+} // namespace common::threading::test
@@ -28,6 +28,7 @@ SOFTWARE.
 #include "common/Logger.hpp"
 
 #include <thread>
+#include <vector>
 
 namespace common::threading::test
 {
@@ -94,4 +95,158 @@ TEST(test_Timer, async_start)
     ASSERT_TRUE(result);
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
 }
-} // namespace common::threading::test
\ No newline at end of file
+
+TEST(test_Timer, fixed_rate_does_not_drift)
+{
+    // given
+    constexpr uint32_t CALLS = 40;
+    auto measure = [](Timer::Schedule::type schedule) {
+        std::atomic<uint32_t> count{0};
+        Timer::Options options;
+        options._schedule = schedule;
+        auto timer = Timer::create([&count]() -> bool{
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            return ++count < CALLS;
+        }, std::chrono::milliseconds(5), options);
+
+        const auto begin = std::chrono::steady_clock::now();
+        timer->start().wait();
+        return std::chrono::steady_clock::now() - begin;
+    };
+
+    // when
+    auto fixedDelay = measure(Timer::Schedule::FIXED_DELAY);
+    auto fixedRate = measure(Timer::Schedule::FIXED_RATE);
+
+    // then
+    ASSERT_GE(fixedDelay, std::chrono::milliseconds(CALLS * 7));
+    ASSERT_LT(fixedRate, std::chrono::milliseconds(CALLS * 7));
+    ASSERT_LT(fixedRate, fixedDelay);
+}
+
+TEST(test_Timer, fixed_rate_skips_overrun)
+{
+    // given
+    std::atomic<uint32_t> count{0};
+    Timer::Options options;
+    options._schedule = Timer::Schedule::FIXED_RATE;
+    options._overrun = Timer::Overrun::SKIP;
+    auto timer = Timer::create([&count]() -> bool{
+        if(count.load() == 0) { std::this_thread::sleep_for(std::chrono::milliseconds(25)); }
+        return ++count < 5;
+    }, std::chrono::milliseconds(5), options);
+
+    // when
+    timer->start().wait();
+    auto statistics = timer->get_statistics();
+
+    // then
+    ASSERT_EQ(statistics._calls, 5);
+    ASSERT_GE(statistics._overruns, 4);
+    ASSERT_EQ(statistics._skipped, statistics._overruns);
+    ASSERT_EQ(statistics._jitter.count(), 5);
+}
+
+TEST(test_Timer, fixed_rate_catches_up_overrun)
+{
+    // given
+    std::atomic<uint32_t> count{0};
+    Timer::Options options;
+    options._schedule = Timer::Schedule::FIXED_RATE;
+    options._overrun = Timer::Overrun::CATCH_UP;
+    auto timer = Timer::create([&count]() -> bool{
+        if(count.load() == 0) { std::this_thread::sleep_for(std::chrono::milliseconds(25)); }
+        return ++count < 10;
+    }, std::chrono::milliseconds(5), options);
+
+    // when
+    const auto begin = std::chrono::steady_clock::now();
+    timer->start().wait();
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    auto statistics = timer->get_statistics();
+
+    // then
+    // The 25 ms stall misses about five 5 ms deadlines, the catch-up calls must not count them again
+    ASSERT_EQ(statistics._calls, 10);
+    ASSERT_GE(statistics._overruns, 4);
+    ASSERT_LE(statistics._overruns, 7);
+    ASSERT_EQ(statistics._skipped, 0);
+    ASSERT_LT(elapsed, std::chrono::milliseconds(75));
+}
+
+TEST(test_Timer, precise_backend)
+{
+    // given
+    constexpr uint32_t CALLS = 200;
+    std::atomic<uint32_t> count{0};
+    Timer::Options options;
+    options._schedule = Timer::Schedule::FIXED_RATE;
+    options._backend = Timer::Backend::PRECISE;
+    auto timer = Timer::create([&count]() -> bool{
+        return ++count < CALLS;
+    }, std::chrono::microseconds(500), options);
+
+    // when
+    const auto begin = std::chrono::steady_clock::now();
+    timer->start().wait();
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    auto statistics = timer->get_statistics();
+
+    // then
+    ASSERT_EQ(count.load(), CALLS);
+    ASSERT_EQ(statistics._calls, CALLS);
+    ASSERT_EQ(statistics._jitter.count(), CALLS);
+    ASSERT_GE(elapsed, std::chrono::microseconds(500 * CALLS));
+    ASSERT_LT(elapsed, std::chrono::microseconds(500 * CALLS * 2));
+}
+
+TEST(test_Timer, precise_backend_stop)
+{
+    // given
+    std::atomic<uint32_t> count{0};
+    Timer::Options options;
+    options._backend = Timer::Backend::PRECISE;
+    auto timer = Timer::create([&count]() -> bool{
+        ++count;
+        return true;
+    }, std::chrono::milliseconds(1), options);
+
+    // when
+    auto future = timer->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    timer->stop();
+
+    // then
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_FALSE(timer->status());
+    ASSERT_GT(count.load(), 0);
+}
+
+TEST(test_Timer, many_short_lived_timers)
+{
+    // given
+    constexpr uint32_t THREADS = 4;
+    constexpr uint32_t TIMERS = 250;
+    std::atomic<uint32_t> finished{0};
+
+    // when
+    std::vector<std::thread> threads;
+    for(uint32_t i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back([&finished]() {
+            for(uint32_t j = 0; j < TIMERS; ++j)
+            {
+                auto timer = Timer::create([]() -> bool{ return true; }, std::chrono::milliseconds(1));
+                auto future = timer->start();
+                if(j % 2 == 0) { std::this_thread::sleep_for(std::chrono::microseconds(100)); }
+                timer->stop();
+                if(future.wait_for(std::chrono::seconds(1)) == std::future_status::ready) { ++finished; }
+            }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    // then
+    ASSERT_EQ(finished.load(), THREADS * TIMERS);
+}
+} // namespace common::threading::test
@@ -0,0 +1,244 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/threading/TimerService.hpp"
+#include "common/threading/Timer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <dirent.h>
+#include <future>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace common::threading::test
+{
+namespace
+{
+auto thread_count() -> size_t
+{
+    size_t count = 0;
+    if(DIR* dir = opendir("/proc/self/task"))
+    {
+        while(dirent* entry = readdir(dir)) { if(entry->d_name[0] != '.') { ++count; } }
+        closedir(dir);
+    }
+    return count;
+}
+} // namespace
+
+TEST(test_TimerService, fires_in_order_and_never_early)
+{
+    // given
+    using Clock = TimerService::Clock;
+    auto service = TimerService::create(TimerService::Dispatcher(), std::chrono::microseconds(100));
+    const std::vector<int32_t> delays = {30, 5, 20, 1, 10, 0};
+
+    std::mutex lock;
+    std::vector<int32_t> order;
+    std::atomic<size_t> early{0};
+
+    // when
+    const auto start = Clock::now();
+    for(auto delay : delays)
+    {
+        const auto due = start + std::chrono::milliseconds(delay);
+        service->schedule_at(due, [&, delay, due]() {
+            if(Clock::now() < due) { early.fetch_add(1); }
+            std::lock_guard<std::mutex> guard(lock);
+            order.push_back(delay);
+        });
+    }
+    while(service->pending() != 0) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // then
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_EQ(early.load(), 0u);
+    ASSERT_EQ(order, (std::vector<int32_t>{0, 1, 5, 10, 20, 30}));
+    ASSERT_EQ(service->pending(), 0u);
+}
+
+TEST(test_TimerService, cascades_through_levels)
+{
+    // given
+    using Clock = TimerService::Clock;
+    // 64 ticks are 640us and 4096 ticks are about 41ms, so these land on levels 0, 1 and 2
+    auto service = TimerService::create(TimerService::Dispatcher(), std::chrono::microseconds(10));
+    const std::vector<std::chrono::microseconds> delays = {std::chrono::microseconds(300),
+                                                           std::chrono::milliseconds(7),
+                                                           std::chrono::milliseconds(60)};
+    std::vector<std::atomic<int64_t>> lateness(delays.size());
+
+    // when
+    for(size_t i = 0; i < delays.size(); ++i)
+    {
+        const auto due = Clock::now() + delays[i];
+        service->schedule_at(due, [&lateness, i, due]() {
+            lateness[i].store(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - due).count());
+        });
+        lateness[i].store(INT64_MIN);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // then
+    for(auto& late : lateness)
+    {
+        ASSERT_NE(late.load(), INT64_MIN);
+        ASSERT_GE(late.load(), 0);
+        ASSERT_LT(late.load(), 20000);
+    }
+}
+
+TEST(test_TimerService, far_timers_with_fine_tick)
+{
+    // given
+    using Clock = TimerService::Clock;
+    auto service = TimerService::create(TimerService::Dispatcher(), std::chrono::nanoseconds(1));
+    const auto start = Clock::now();
+    service->schedule_at(start + std::chrono::hours(24), []() {});
+    service->schedule_at(start + std::chrono::seconds(1), []() {});
+
+    // when
+    std::promise<Clock::time_point> fired;
+    auto future = fired.get_future();
+    const auto due = start + std::chrono::milliseconds(100);
+    service->schedule_at(due, [&fired]() { fired.set_value(Clock::now()); });
+
+    // then
+    // Billions of empty ticks lie between the wheel turns, walking them would make the timer late
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_LT(future.get() - due, std::chrono::milliseconds(50));
+    ASSERT_EQ(service->pending(), 2u);
+}
+
+TEST(test_TimerService, cancel)
+{
+    // given
+    auto service = TimerService::create();
+    std::atomic<size_t> fired{0};
+
+    // when
+    auto cancelled = service->schedule_after(std::chrono::milliseconds(20), [&]() { fired.fetch_add(1); });
+    auto expired = service->schedule_after(std::chrono::milliseconds(1), [&]() { fired.fetch_add(1); });
+    const size_t pending = service->pending();
+    const bool first = service->cancel(cancelled);
+    const bool second = service->cancel(cancelled);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    const bool late = service->cancel(expired);
+
+    // then
+    ASSERT_EQ(pending, 2u);
+    ASSERT_TRUE(first);
+    ASSERT_FALSE(second);
+    ASSERT_FALSE(late);
+    ASSERT_FALSE(service->cancel(TimerService::Handle()));
+    ASSERT_EQ(fired.load(), 1u);
+}
+
+TEST(test_TimerService, many_timers_on_executor)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    auto service = TimerService::create(executor);
+    constexpr size_t COUNT = 10000;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int32_t> delay(0, 50);
+    std::atomic<size_t> fired{0};
+
+    // when
+    std::vector<TimerService::Handle> handles;
+    for(size_t i = 0; i < COUNT; ++i)
+    {
+        handles.push_back(service->schedule_after(std::chrono::milliseconds(delay(random)) + std::chrono::milliseconds(100),
+                                                  [&]() { fired.fetch_add(1); }));
+    }
+    size_t cancelled = 0;
+    for(size_t i = 0; i < COUNT; i += 2) { cancelled += service->cancel(handles[i]) ? 1 : 0; }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while(fired.load() < COUNT - cancelled && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // then
+    ASSERT_GT(cancelled, 0u);
+    ASSERT_EQ(fired.load(), COUNT - cancelled);
+    ASSERT_EQ(service->pending(), 0u);
+    service->stop();
+    executor->stop();
+}
+
+TEST(test_TimerService, stop_drops_pending)
+{
+    // given
+    auto service = TimerService::create();
+    std::atomic<size_t> fired{0};
+    service->schedule_after(std::chrono::milliseconds(10), [&]() { fired.fetch_add(1); });
+
+    // when
+    service->stop();
+    auto handle = service->schedule_after(std::chrono::milliseconds(1), [&]() { fired.fetch_add(1); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // then
+    ASSERT_FALSE(handle);
+    ASSERT_EQ(fired.load(), 0u);
+    ASSERT_EQ(service->pending(), 0u);
+}
+
+TEST(test_TimerService, timers_share_threads)
+{
+    // given
+    constexpr size_t COUNT = 200;
+    std::atomic<size_t> ticks{0};
+    std::vector<std::unique_ptr<Timer, std::function<void(Timer*)>>> timers;
+    std::vector<std::future<void>> futures;
+    Timer::create([]() { return false; }, std::chrono::microseconds(1))->start().wait();
+    const size_t before = thread_count();
+
+    // when
+    for(size_t i = 0; i < COUNT; ++i)
+    {
+        timers.push_back(Timer::create([&ticks]() {
+            ticks.fetch_add(1);
+            return true;
+        }, std::chrono::milliseconds(5)));
+        futures.push_back(timers.back()->start());
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const size_t during = thread_count();
+    timers.clear();
+
+    // then
+    ASSERT_LE(during, before + 1);
+    ASSERT_GE(ticks.load(), COUNT);
+    for(auto& future : futures) { ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready); }
+}
+} // namespace common::threading::test
@@ -0,0 +1,67 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/threading/Topology.hpp"
+
+namespace common::threading::test
+{
+TEST(test_Topology, parse_cpu_list)
+{
+    // given
+    const std::string single{"3"};
+    const std::string ranges{"0-3,8,10-11\n"};
+    const std::string unordered{"5,1-2,2"};
+    const std::string malformed{"x,4,7-5,"};
+
+    // when
+    const auto singleCpus = parse_cpu_list(single);
+    const auto rangeCpus = parse_cpu_list(ranges);
+    const auto unorderedCpus = parse_cpu_list(unordered);
+    const auto malformedCpus = parse_cpu_list(malformed);
+
+    // then
+    ASSERT_EQ(singleCpus, (std::vector<uint32_t>{3}));
+    ASSERT_EQ(rangeCpus, (std::vector<uint32_t>{0, 1, 2, 3, 8, 10, 11}));
+    ASSERT_EQ(unorderedCpus, (std::vector<uint32_t>{1, 2, 5}));
+    ASSERT_EQ(malformedCpus, (std::vector<uint32_t>{4}));
+    ASSERT_TRUE(parse_cpu_list("").empty());
+}
+
+TEST(test_Topology, get_numa_nodes)
+{
+    // given
+    // when
+    const auto nodes = get_numa_nodes();
+
+    // then
+    ASSERT_FALSE(nodes.empty());
+    for(size_t i = 0; i < nodes.size(); ++i)
+    {
+        ASSERT_FALSE(nodes[i]._cpus.empty());
+        if(i > 0) { ASSERT_LT(nodes[i - 1]._id, nodes[i]._id); }
+    }
+}
+} // namespace common::threading::test
@@ -0,0 +1,103 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/utils/Histogram.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace common::utils::test
+{
+TEST(test_Histogram, bucket_bounds)
+{
+    // given
+    const std::vector<uint64_t> values{0, 1, 31, 32, 33, 1000, 123456789, Histogram::MAX_VALUE};
+
+    // when
+    // then
+    for(auto value : values)
+    {
+        const auto index = Histogram::index_of(value);
+        ASSERT_LT(index, Histogram::BUCKET_COUNT);
+        ASSERT_LE(Histogram::lower_bound(index), value);
+        ASSERT_GE(Histogram::upper_bound(index), value);
+        // Relative error stays below 1 / SUB_BUCKET_COUNT
+        ASSERT_LE((Histogram::upper_bound(index) - Histogram::lower_bound(index)) * Histogram::SUB_BUCKET_COUNT, 
+                  std::max<uint64_t>(value, Histogram::SUB_BUCKET_COUNT));
+    }
+    for(size_t i = 1; i < Histogram::BUCKET_COUNT; ++i)
+    {
+        ASSERT_EQ(Histogram::lower_bound(i), Histogram::upper_bound(i - 1) + 1);
+    }
+    ASSERT_EQ(Histogram::index_of(Histogram::MAX_VALUE + 1000), Histogram::BUCKET_COUNT - 1);
+}
+
+TEST(test_Histogram, percentile)
+{
+    // given
+    Histogram histogram;
+
+    // when
+    for(uint64_t value = 1; value <= 10000; ++value) { histogram.record(value); }
+
+    // then
+    ASSERT_EQ(histogram.count(), 10000u);
+    ASSERT_DOUBLE_EQ(histogram.mean(), 5000.5);
+    ASSERT_EQ(histogram.min(), 1u);
+    ASSERT_NEAR(static_cast<double>(histogram.max()), 10000.0, 10000.0 / Histogram::SUB_BUCKET_COUNT);
+    ASSERT_NEAR(static_cast<double>(histogram.percentile(50.0)), 5000.0, 5000.0 / Histogram::SUB_BUCKET_COUNT);
+    ASSERT_NEAR(static_cast<double>(histogram.percentile(99.0)), 9900.0, 9900.0 / Histogram::SUB_BUCKET_COUNT);
+    ASSERT_EQ(Histogram().percentile(50.0), 0u);
+}
+
+TEST(test_Histogram, atomic_snapshot_and_reset)
+{
+    // given
+    AtomicHistogram recorder;
+    constexpr uint64_t perThread = 10000;
+
+    // when
+    std::vector<std::thread> threads;
+    for(uint64_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&recorder, t]() {
+            for(uint64_t i = 0; i < perThread; ++i) { recorder.record(t * 100 + i % 10); }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    Histogram snapshot;
+    recorder.snapshot(snapshot);
+    recorder.reset();
+    Histogram empty;
+    recorder.snapshot(empty);
+
+    // then
+    ASSERT_EQ(snapshot.count(), 4 * perThread);
+    ASSERT_EQ(snapshot.bucket(Histogram::index_of(0)), perThread / 10);
+    ASSERT_EQ(empty.count(), 0u);
+}
+} // namespace common::utils::test